@@ -15,6 +15,46 @@
 #ifdef SET_SORT_EXTRA
 #define SORT_EXTRA
 #endif
+#ifdef SET_SORT_PARALLEL
+#define SORT_PARALLEL
+#endif
+#include "sort.h"
+
+/* the same keys as SORT_PRIMITIVE, for radix sort and the SIMD kernels; sorter stays
+   scalar, so its rows can be compared with earlier runs */
+#define SORT_NAME prim64
+#define SORT_TYPE int64_t
+#define SORT_PRIMITIVE
+#ifdef SET_SORT_PARALLEL
+#define SORT_PARALLEL
+#endif
+#include "sort.h"
+
+#define SORT_NAME strings
+#define SORT_TYPE char*
+#define SORT_STRING
+#define SORT_CMP(x, y) strcmp((x), (y))
+#ifdef SET_SORT_PARALLEL
+#define SORT_PARALLEL
+#endif
+#include "sort.h"
+
+#define SORT_NAME blocks
+#define SORT_TYPE int64_t
+#define SORT_BLOCK_PARTITION
+#define SORT_CMP(x, y) ((x) - (y))
+#include "sort.h"
+
+#define SORT_NAME pdq
+#define SORT_TYPE int64_t
+#define SORT_PDQSORT
+#define SORT_CMP(x, y) ((x) - (y))
+#include "sort.h"
+
+#define SORT_NAME fat
+#define SORT_TYPE int64_t
+#define SORT_FAT_PARTITION
+#define SORT_CMP(x, y) ((x) - (y))
 #include "sort.h"
 
 /* Used to control the stress test */
@@ -22,6 +62,8 @@
 #define FAST_ITERATIONS 1
 #define SLOW_ITERATIONS 1
 #define SIZES 1
+#define BENCH_TOP_K 1000
+#define BENCH_STRING_LEN 48
 
 size_t sizes[SIZES] = {100000};
 
@@ -47,6 +89,26 @@ static void fill_random(int64_t *dst, const int size) {
   }
 }
 
+/* a handful of distinct keys, like a status or country column */
+static void fill_few_unique(int64_t *dst, const int size) {
+  int i;
+  srand48(SEED);
+
+  for (i = 0; i < size; i++) {
+    dst[i] = lrand48() % 8;
+  }
+}
+
+static void fill_strings(char **dst, char *chars, const int size) {
+  int i;
+  srand48(SEED);
+
+  for (i = 0; i < size; i++) {
+    dst[i] = chars + BENCH_STRING_LEN * i;
+    sprintf(dst[i], "https://example.com/%ld/%ld", lrand48() % 1000, lrand48());
+  }
+}
+
 void capitalize(const char *word, char *new_word) {
   int len;
   len = strlen(word);
@@ -107,7 +169,7 @@ void platform_name(char *output) {
   } \
 } while (0)
 
-#define TEST_SORT_H(name) do { \
+#define TEST_FILL_CALL(name, fill_fn, call) do { \
   capitalize(#name, capital_word); \
   for (test = 0; test < SIZES; test++) { \
     int64_t size = sizes[test]; \
@@ -115,9 +177,40 @@ void platform_name(char *output) {
     diff = 0; \
     iter = 0; \
     while (1) { \
-      fill_random(dst, size); \
+      fill_fn(dst, size); \
+      usec1 = utime(); \
+      call; \
+      usec2 = utime(); \
+      diff += usec2 - usec1; \
+      iter++; \
+      if (diff >= 1000000.0) { \
+        break; \
+      } \
+    } \
+    free(dst); \
+    sprintf(name_buf, "%s %lld %s", capital_word, size, platform); \
+    printf("%-40s %4d %16.1f ns/op\n", name_buf, iter, diff * 1000.0 / (double) iter); \
+  } \
+} while (0)
+
+#ifdef SET_SORT_PARALLEL
+/* one pool for all of the parallel runs, so they don't pay for starting threads */
+static sort_ctx *bench_ctx;
+#endif
+
+/* the same, on URL-like keys sharing long prefixes, by the strings instance */
+#define TEST_STRINGS(name, call) do { \
+  capitalize(#name, capital_word); \
+  for (test = 0; test < SIZES; test++) { \
+    int64_t size = sizes[test]; \
+    char *chars = (char *) malloc(BENCH_STRING_LEN * size); \
+    char **dst = (char **) malloc(sizeof(char *) * size); \
+    diff = 0; \
+    iter = 0; \
+    while (1) { \
+      fill_strings(dst, chars, size); \
       usec1 = utime(); \
-      sorter_ ## name (dst, size); \
+      call; \
       usec2 = utime(); \
       diff += usec2 - usec1; \
       iter++; \
@@ -126,11 +219,52 @@ void platform_name(char *output) {
       } \
     } \
     free(dst); \
+    free(chars); \
     sprintf(name_buf, "%s %lld %s", capital_word, size, platform); \
     printf("%-40s %4d %16.1f ns/op\n", name_buf, iter, diff * 1000.0 / (double) iter); \
   } \
 } while (0)
 
+#define TEST_SORT_CALL(name, call) TEST_FILL_CALL(name, fill_random, call)
+#define TEST_SORT_H(name) TEST_SORT_CALL(name, sorter_ ## name (dst, size))
+#define TEST_SORT_H_THREADS(name) TEST_SORT_CALL(name, sorter_ ## name (dst, size, bench_ctx))
+#define TEST_TOP_K(name) TEST_SORT_CALL(name, sorter_ ## name (dst, size, BENCH_TOP_K, top))
+#define TEST_TOP_K_THREADS(name) TEST_SORT_CALL(name, sorter_ ## name (dst, size, BENCH_TOP_K, top, bench_ctx))
+#define TEST_NTH_ELEMENT(name) TEST_SORT_CALL(name, sorter_ ## name (dst, size, size / 2))
+#define TEST_NTH_ELEMENT_THREADS(name) TEST_SORT_CALL(name, sorter_ ## name (dst, size, size / 2, bench_ctx))
+
+/* lots of tiny segments, from 2 to 32 elements */
+static size_t *segment_offsets(const size_t size, size_t *nsegments) {
+  size_t *offsets = (size_t *) malloc((size / 2 + 2) * sizeof(size_t));
+  size_t n = 0;
+  offsets[0] = 0;
+
+  while (offsets[n] < size) {
+    offsets[n + 1] = MIN(offsets[n] + 2 + n % 31, size);
+    n++;
+  }
+
+  *nsegments = n;
+  return offsets;
+}
+
+static void segmented_sort(int64_t *dst, const size_t size, const int parallel) {
+  size_t nsegments;
+  size_t *offsets = segment_offsets(size, &nsegments);
+#ifdef SET_SORT_PARALLEL
+
+  if (parallel) {
+    sorter_parallel_segmented_sort(dst, offsets, nsegments, bench_ctx);
+  } else {
+    sorter_segmented_sort(dst, offsets, nsegments);
+  }
+
+#else
+  (void) parallel;
+  sorter_segmented_sort(dst, offsets, nsegments);
+#endif
+  free(offsets);
+}
 
 int main(void) {
   int test, iter;
@@ -138,6 +272,7 @@ int main(void) {
   char capital_word[128];
   char platform[128];
   char name_buf[128];
+  int64_t top[BENCH_TOP_K];
   \
   platform_name(platform);
   TEST_STDLIB(qsort);
@@ -148,16 +283,51 @@ int main(void) {
   TEST_SORT_H(binary_insertion_sort);
   TEST_SORT_H(bitonic_sort);
   TEST_SORT_H(quick_sort);
+  TEST_SORT_CALL(block_quick_sort, blocks_quick_sort(dst, size));
+  TEST_SORT_CALL(pdq_quick_sort, pdq_quick_sort(dst, size));
+  TEST_SORT_CALL(fat_quick_sort, fat_quick_sort(dst, size));
+  TEST_FILL_CALL(few_unique_quick_sort, fill_few_unique, sorter_quick_sort(dst, size));
+  TEST_FILL_CALL(few_unique_pdq_quick_sort, fill_few_unique, pdq_quick_sort(dst, size));
+  TEST_FILL_CALL(few_unique_fat_quick_sort, fill_few_unique, fat_quick_sort(dst, size));
   TEST_SORT_H(merge_sort);
   TEST_SORT_H(heap_sort);
   TEST_SORT_H(shell_sort);
   TEST_SORT_H(tim_sort);
   TEST_SORT_H(merge_sort_in_place);
+  TEST_SORT_H(sample_sort);
+  TEST_SORT_CALL(simd_quick_sort, prim64_quick_sort(dst, size));
+  TEST_SORT_CALL(simd_merge_sort, prim64_merge_sort(dst, size));
+  TEST_SORT_CALL(simd_tim_sort, prim64_tim_sort(dst, size));
+  TEST_SORT_CALL(radix_sort, prim64_radix_sort(dst, size));
+  TEST_TOP_K(top_k);
+  TEST_NTH_ELEMENT(nth_element);
+  TEST_SORT_CALL(segmented_sort, segmented_sort(dst, size, 0));
+  TEST_SORT_H(sort_unique);
+  TEST_STRINGS(string_quick_sort, strings_quick_sort(dst, size));
+  TEST_STRINGS(string_sort, strings_string_sort(dst, size));
 #ifdef SET_SORT_EXTRA
   TEST_SORT_H(grail_sort);
   TEST_SORT_H(sqrt_sort);
   TEST_SORT_H(rec_stable_sort);
   TEST_SORT_H(grail_sort_dyn_buffer);
+#endif
+#ifdef SET_SORT_PARALLEL
+  bench_ctx = sort_ctx_create(NULL);
+  TEST_SORT_H_THREADS(parallel_quick_sort);
+  TEST_SORT_H_THREADS(parallel_tim_sort);
+  TEST_SORT_H_THREADS(parallel_merge_sort);
+  TEST_SORT_H_THREADS(parallel_sample_sort);
+  TEST_SORT_H_THREADS(parallel_shell_sort);
+  TEST_SORT_CALL(parallel_radix_sort, prim64_parallel_radix_sort(dst, size, bench_ctx));
+#ifdef SET_SORT_EXTRA
+  TEST_SORT_H_THREADS(parallel_grail_sort);
+#endif
+  TEST_TOP_K_THREADS(parallel_top_k);
+  TEST_NTH_ELEMENT_THREADS(parallel_nth_element);
+  TEST_SORT_CALL(parallel_segmented_sort, segmented_sort(dst, size, 1));
+  TEST_SORT_H_THREADS(parallel_sort_unique);
+  TEST_STRINGS(parallel_string_sort, strings_parallel_string_sort(dst, size, bench_ctx));
+  sort_ctx_destroy(bench_ctx);
 #endif
   return 0;
 }
@@ -15,6 +15,8 @@
 #define MAX(x,y) (((x) > (y) ? (x) : (y)))
 #define MIN(x,y) (((x) < (y) ? (x) : (y)))
 #define SORT_CSWAP(x, y) {SORT_TYPE _sort_swap_temp = MAX((x), (y)); (x) = MIN((x),(y)); (y) = _sort_swap_temp;}
+/* int64_t is a plain integer in its natural order, so radix sort works on it too */
+#define SORT_PRIMITIVE
 #ifdef SET_SORT_EXTRA
 #define SORT_EXTRA
 #endif
@@ -29,6 +31,8 @@
    * sorter_merge_sort
    * sorter_selection_sort
    * sorter_tim_sort
+   * sorter_sample_sort
+   * sorter_radix_sort
 
    Each takes two arguments: int64_t *array, size_t size
 */
@@ -275,6 +279,34 @@ void run_tests(void) {
   printf("in-place merge sort time:        %10.2f us per iteration\n", total_time / RUNS);
   srand48(SEED);
   total_time = 0.0;
+
+  for (i = 0; i < RUNS; i++) {
+    fill(arr, SIZE);
+    memcpy(dst, arr, sizeof(int64_t) * SIZE);
+    start_time = utime();
+    sorter_sample_sort(dst, SIZE);
+    end_time = utime();
+    total_time += end_time - start_time;
+    verify(dst, SIZE);
+  }
+
+  printf("sample sort time:                %10.2f us per iteration\n", total_time / RUNS);
+  srand48(SEED);
+  total_time = 0.0;
+
+  for (i = 0; i < RUNS; i++) {
+    fill(arr, SIZE);
+    memcpy(dst, arr, sizeof(int64_t) * SIZE);
+    start_time = utime();
+    sorter_radix_sort(dst, SIZE);
+    end_time = utime();
+    total_time += end_time - start_time;
+    verify(dst, SIZE);
+  }
+
+  printf("radix sort time:                 %10.2f us per iteration\n", total_time / RUNS);
+  srand48(SEED);
+  total_time = 0.0;
 #ifdef SET_SORT_EXTRA
 
   for (i = 0; i < RUNS; i++) {
@@ -1,148 +1,214 @@
-import requests
-
-max_small_sort = 16
-small_sort_only = True 
-
-def generate_small_sort(n, rev=False):
-    s = "http://jgamble.ripco.net/cgi-bin/nw.cgi?inputs=%d&algorithm=best&output=svg" % n
-    ret = requests.get(s)
-    content = ret.text
-    lines = [l for l in content.split('\n') if l.startswith('[[')]
-    swps = ""
-    for _l in lines:
-        l = _l[1:-1]
-        ll = l.split(']')
-        for _t in ll:
-            if '[' not in _t:
-                continue
-            t = _t.split('[')[-1]
-            i, j = t.split(',')
-            if not rev:
-                swps += "\tSORT_CSWAP(dst[%s], dst[%s]);\n" % (i, j)
-            else:
-                swps += "\tSORT_CSWAP(dst[%s], dst[%s]);\n" % (j, i)
-        swps += '\n'
-    if not rev:
-        f = """
-#define BITONIC_SORT_%d          SORT_MAKE_STR(bitonic_sort_%d)
-static __inline void BITONIC_SORT_%d(SORT_TYPE *dst) {
-%s}
-""" % (n, n, n, swps[:-1])
-    else:
-        f = """
-#define BITONIC_SORT_REVERSE_%d          SORT_MAKE_STR(bitonic_sort_reverse_%d)
-static __inline void BITONIC_SORT_REVERSE_%d(SORT_TYPE *dst) {
-%s}
-""" % (n, n, n, swps[:-1])
-    return f
-
-
-bitonic_sort_str = """
-#ifndef SORT_CSWAP
-  #define SORT_CSWAP(x, y) { if(SORT_CMP((x),(y)) > 0) {SORT_SWAP((x),(y));}}
-#endif
-"""
-bitonic_sort_str += "\n".join(generate_small_sort(i) for i in range(2,max_small_sort+1))
-
-if small_sort_only:
-    bitonic_sort_case = "\n".join("        case %d:\n            BITONIC_SORT_%d(dst);\n            break;" % (n, n) for n in range(2, max_small_sort+1))
-    bitonic_sort_str += """
-void BITONIC_SORT(SORT_TYPE *dst, const size_t size) {
-    switch(size) {
-        case 0:
-        case 1:
-            break;
-%s
-        default:
-            BINARY_INSERTION_SORT(dst, size);
-        }
-}
-    """ % (bitonic_sort_case)
-    print(bitonic_sort_str)
-    exit()
-    
-
-
-bitonic_sort_str += "\n".join(generate_small_sort(i, rev=True) for i in range(2,max_small_sort+1))
-
-bitonic_sort_case = "\n".join("        case %d:\n            BITONIC_SORT_%d(dst);\n            break;" % (n, n) for n in range(2, max_small_sort+1))
-bitonic_sort_case_rev = "\n".join("        case %d:\n            BITONIC_SORT_REVERSE_%d(dst);\n            break;" % (n, n) for n in range(2, max_small_sort+1))
-
-bitonic_sort_str += """
-#define BITONIC_SORT          SORT_MAKE_STR(bitonic_sort)
-void BITONIC_SORT(SORT_TYPE *dst, const size_t size);
-#define BITONIC_SORT_REVERSE          SORT_MAKE_STR(bitonic_sort_reverse)
-void BITONIC_SORT_REVERSE(SORT_TYPE *dst, const size_t size);
-"""
-
-bitonic_sort_str += """
-#define BITONIC_MERGE          SORT_MAKE_STR(bitonic_merge)
-void BITONIC_MERGE(SORT_TYPE *dst, const size_t size) {
-  size_t m, i, j;
-  if (size <= 1) {
-      return;
-  }
-  m = 1ULL<<(63 - CLZ(size-1));
-  j = m;
-  for (i = 0; i < size - m; ++i, ++j) {
-      SORT_CSWAP(dst[i], dst[j]);
-  }
-  BITONIC_MERGE(dst, m);
-  BITONIC_MERGE(dst + m, size - m);
-}
-
-#define BITONIC_MERGE_REVERSE          SORT_MAKE_STR(bitonic_merge_reverse)
-void BITONIC_MERGE_REVERSE(SORT_TYPE *dst, const size_t size) {
-  size_t m, i, j;
-  if (size <= 1) {
-      return;
-  }
-  m = 1ULL<<(63 - CLZ(size-1));
-  j = m;
-  for (i = 0; i < size - m; ++i, ++j) {
-      SORT_CSWAP(dst[j], dst[i]);
-  }
-  BITONIC_MERGE_REVERSE(dst, m);
-  BITONIC_MERGE_REVERSE(dst + m, size - m);
-}
-
-"""
-
-bitonic_sort_str += """
-void BITONIC_SORT(SORT_TYPE *dst, const size_t size) {
-    switch(size) {
-        case 0:
-        case 1:
-            break;
-%s
-        default:
-            /*printf("Bitonic sort size = %%ld", size);*/
-            BITONIC_SORT_REVERSE(dst, (size>>1));
-            BITONIC_SORT(dst + (size>>1), size - (size>>1));
-            BITONIC_MERGE(dst, size);
-    }
-}
-""" % (bitonic_sort_case)
-
-bitonic_sort_str += """
-void BITONIC_SORT_REVERSE(SORT_TYPE *dst, const size_t size) {
-    switch(size) {
-        case 0:
-        case 1:
-            break;
-%s
-        default:
-            /*printf("Bitonic sort reverse size = %%ld", size);*/
-            BITONIC_SORT(dst, (size>>1));
-            BITONIC_SORT_REVERSE(dst + (size>>1), size - (size>>1));
-            BITONIC_MERGE_REVERSE(dst, size);
-    }
-}
-""" % (bitonic_sort_case_rev)
-
-import os
-
-with open('bitonic_sort.h', 'w') as F:
-  F.write(bitonic_sort_str)
-
-os.system('astyle --options=astyle.options bitonic_sort.h')
\ No newline at end of file
+"""Writes sort_networks.h, the sorting networks sort.h uses for 17 to 64 elements when
+SMALL_SORT_BND is raised past 16.
+
+Nothing is fetched: the best known networks for up to 16 elements (the ones in
+sort.h, from https://pages.ripco.net/~jgamble/nw.html; 16 is Green's network)
+are put together into bigger ones with Batcher's odd-even merge.  A network for n
+elements sorts two parts of it and merges them with the odd-even merge for twice the
+power of two that holds the bigger part, the parts lined up on either side of its
+middle, leaving out the comparators that would touch the elements the parts fall short
+by (they would sit below the lower part as -infinity, or above the upper one as
++infinity, and never move).  Of all the ways to split n, the one with the fewest
+comparators, and then layers, is kept.  For 32 that comes to 185 comparators, as many
+as the best known, and for 64 to 531.
+
+Every network is checked before it is written: the ones for up to 16 elements on all
+0-1 inputs, and the merge of each bigger one on every input whose two parts are
+sorted, which by the 0-1 principle is enough since the parts are sorted by networks
+already checked.  The comparators are written a layer at a time, so the ones that
+can run side by side are next to each other."""
+
+import os
+import shutil
+
+min_network = 17
+max_network = 64
+
+best_networks = {
+    2: [(0, 1)],
+    3: [(1, 2), (0, 2), (0, 1)],
+    4: [(0, 1), (2, 3), (0, 2), (1, 3), (1, 2)],
+    5: [(0, 1), (3, 4), (2, 4), (2, 3), (1, 4), (0, 3), (0, 2), (1, 3), (1, 2)],
+    6: [(1, 2), (4, 5), (0, 2), (3, 5), (0, 1), (3, 4), (2, 5), (0, 3), (1, 4), (2, 4),
+        (1, 3), (2, 3)],
+    7: [(1, 2), (3, 4), (5, 6), (0, 2), (3, 5), (4, 6), (0, 1), (4, 5), (2, 6), (0, 4),
+        (1, 5), (0, 3), (2, 5), (1, 3), (2, 4), (2, 3)],
+    8: [(0, 1), (2, 3), (4, 5), (6, 7), (0, 2), (1, 3), (4, 6), (5, 7), (1, 2), (5, 6),
+        (0, 4), (3, 7), (1, 5), (2, 6), (1, 4), (3, 6), (2, 4), (3, 5), (3, 4)],
+    9: [(0, 1), (3, 4), (6, 7), (1, 2), (4, 5), (7, 8), (0, 1), (3, 4), (6, 7), (2, 5),
+        (0, 3), (1, 4), (5, 8), (3, 6), (4, 7), (2, 5), (0, 3), (1, 4), (5, 7), (2, 6),
+        (1, 3), (4, 6), (2, 4), (5, 6), (2, 3)],
+    10: [(4, 9), (3, 8), (2, 7), (1, 6), (0, 5), (1, 4), (6, 9), (0, 3), (5, 8), (0, 2),
+         (3, 6), (7, 9), (0, 1), (2, 4), (5, 7), (8, 9), (1, 2), (4, 6), (7, 8), (3, 5),
+         (2, 5), (6, 8), (1, 3), (4, 7), (2, 3), (6, 7), (3, 4), (5, 6), (4, 5)],
+    11: [(0, 1), (2, 3), (4, 5), (6, 7), (8, 9), (1, 3), (5, 7), (0, 2), (4, 6), (8, 10),
+         (1, 2), (5, 6), (9, 10), (0, 4), (3, 7), (1, 5), (6, 10), (4, 8), (5, 9), (2, 6),
+         (0, 4), (3, 8), (1, 5), (6, 10), (2, 3), (8, 9), (1, 4), (7, 10), (3, 5), (6, 8),
+         (2, 4), (7, 9), (5, 6), (3, 4), (7, 8)],
+    12: [(0, 1), (2, 3), (4, 5), (6, 7), (8, 9), (10, 11), (1, 3), (5, 7), (9, 11), (0, 2),
+         (4, 6), (8, 10), (1, 2), (5, 6), (9, 10), (0, 4), (7, 11), (1, 5), (6, 10), (3, 7),
+         (4, 8), (5, 9), (2, 6), (0, 4), (7, 11), (3, 8), (1, 5), (6, 10), (2, 3), (8, 9),
+         (1, 4), (7, 10), (3, 5), (6, 8), (2, 4), (7, 9), (5, 6), (3, 4), (7, 8)],
+    13: [(1, 7), (9, 11), (3, 4), (5, 8), (0, 12), (2, 6), (0, 1), (2, 3), (4, 6), (8, 11),
+         (7, 12), (5, 9), (0, 2), (3, 7), (10, 11), (1, 4), (6, 12), (7, 8), (11, 12), (4, 9),
+         (6, 10), (3, 4), (5, 6), (8, 9), (10, 11), (1, 7), (2, 6), (9, 11), (1, 3), (4, 7),
+         (8, 10), (0, 5), (2, 5), (6, 8), (9, 10), (1, 2), (3, 5), (7, 8), (4, 6), (2, 3),
+         (4, 5), (6, 7), (8, 9), (3, 4), (5, 6)],
+    14: [(0, 1), (2, 3), (4, 5), (6, 7), (8, 9), (10, 11), (12, 13), (0, 2), (4, 6), (8, 10),
+         (1, 3), (5, 7), (9, 11), (0, 4), (8, 12), (1, 5), (9, 13), (2, 6), (3, 7), (0, 8),
+         (1, 9), (2, 10), (3, 11), (4, 12), (5, 13), (5, 10), (6, 9), (3, 12), (7, 11),
+         (1, 2), (4, 8), (1, 4), (7, 13), (2, 8), (5, 6), (9, 10), (2, 4), (11, 13), (3, 8),
+         (7, 12), (6, 8), (10, 12), (3, 5), (7, 9), (3, 4), (5, 6), (7, 8), (9, 10),
+         (11, 12), (6, 7), (8, 9)],
+    15: [(0, 1), (2, 3), (4, 5), (6, 7), (8, 9), (10, 11), (12, 13), (0, 2), (4, 6), (8, 10),
+         (12, 14), (1, 3), (5, 7), (9, 11), (0, 4), (8, 12), (1, 5), (9, 13), (2, 6),
+         (10, 14), (3, 7), (0, 8), (1, 9), (2, 10), (3, 11), (4, 12), (5, 13), (6, 14),
+         (5, 10), (6, 9), (3, 12), (13, 14), (7, 11), (1, 2), (4, 8), (1, 4), (7, 13), (2, 8),
+         (11, 14), (5, 6), (9, 10), (2, 4), (11, 13), (3, 8), (7, 12), (6, 8), (10, 12),
+         (3, 5), (7, 9), (3, 4), (5, 6), (7, 8), (9, 10), (11, 12), (6, 7), (8, 9)],
+    16: [(0, 1), (2, 3), (4, 5), (6, 7), (8, 9), (10, 11), (12, 13), (14, 15), (0, 2), (4, 6),
+         (8, 10), (12, 14), (1, 3), (5, 7), (9, 11), (13, 15), (0, 4), (8, 12), (1, 5),
+         (9, 13), (2, 6), (10, 14), (3, 7), (11, 15), (0, 8), (1, 9), (2, 10), (3, 11),
+         (4, 12), (5, 13), (6, 14), (7, 15), (5, 10), (6, 9), (3, 12), (13, 14), (7, 11),
+         (1, 2), (4, 8), (1, 4), (7, 13), (2, 8), (11, 14), (5, 6), (9, 10), (2, 4),
+         (11, 13), (3, 8), (7, 12), (6, 8), (10, 12), (3, 5), (7, 9), (3, 4), (5, 6), (7, 8),
+         (9, 10), (11, 12), (6, 7), (8, 9)],
+}
+
+
+def odd_even_merge(lo, n, r=1):
+    """Batcher's merge of the sorted halves of the n (a power of two) wires from lo."""
+    step = 2 * r
+    if step >= n:
+        return [(lo, lo + r)]
+    pairs = odd_even_merge(lo, n, step) + odd_even_merge(lo + r, n, step)
+    return pairs + [(i, i + r) for i in range(lo + r, lo + n - r, step)]
+
+
+def depth(pairs):
+    """How many layers the comparators take, each going as early as it can."""
+    ready = {}
+    for i, j in pairs:
+        ready[i] = ready[j] = max(ready.get(i, 0), ready.get(j, 0)) + 1
+    return max(ready.values()) if ready else 0
+
+
+def layered(pairs):
+    """The same network with the comparators of each layer next to each other."""
+    ready = {}
+    layers = []
+    for i, j in pairs:
+        layer = max(ready.get(i, 0), ready.get(j, 0))
+        ready[i] = ready[j] = layer + 1
+        layers.append(layer)
+    return [p for _, _, p in sorted(zip(layers, range(len(pairs)), pairs))]
+
+
+def shifted(pairs, offset):
+    return [(i + offset, j + offset) for i, j in pairs]
+
+
+networks = {}
+merged_parts = {}
+
+
+def network(n):
+    """The fewest comparators (then layers) we can sort n elements with."""
+    if n < 2:
+        return []
+    if n in networks:
+        return networks[n]
+    if n in best_networks:
+        networks[n] = best_networks[n]
+        return networks[n]
+    for a in range((n + 1) // 2, n):
+        # the lower part of a elements ends at the middle of the merge and the
+        # upper one starts there; its comparators with the wires below and above
+        # them go
+        half = 1 << (a - 1).bit_length()
+        below = half - a
+        pairs = (network(a) + shifted(network(n - a), a) +
+                 [(i - below, j - below) for i, j in odd_even_merge(0, 2 * half)
+                  if i >= below and j < half + n - a])
+        cost = (len(pairs), depth(pairs))
+        if n not in networks or cost < (len(networks[n]), depth(networks[n])):
+            networks[n], merged_parts[n] = pairs, a
+    return networks[n]
+
+
+def sorts(pairs, inputs):
+    for values in inputs:
+        values = list(values)
+        for i, j in pairs:
+            if values[i] > values[j]:
+                values[i], values[j] = values[j], values[i]
+        if any(values[k] > values[k + 1] for k in range(len(values) - 1)):
+            return False
+    return True
+
+
+def check(n):
+    if n < 2:
+        return True
+    if n in best_networks:
+        # every 0-1 input at once: bit x of wires[i] is wire i given input x
+        wires = [int(('0' * (1 << i) + '1' * (1 << i)) * (1 << (n - i - 1)), 2)
+                 for i in range(n)]
+        for i, j in network(n):
+            wires[i], wires[j] = wires[i] & wires[j], wires[i] | wires[j]
+        return all(wires[k] & ~wires[k + 1] == 0 for k in range(n - 1))
+    pairs = network(n)
+    a = merged_parts[n]
+    inputs = ([0] * (a - x) + [1] * x + [0] * (n - a - y) + [1] * y
+              for x in range(a + 1) for y in range(n - a + 1))
+    return check(a) and check(n - a) and sorts(pairs, inputs)
+
+
+def generate_network(n):
+    pairs = layered(network(n))
+    swps = "".join("  SORT_CSWAP(dst[%d], dst[%d]);\n" % p for p in pairs)
+    return """
+#define BITONIC_SORT_%d          SORT_MAKE_STR(bitonic_sort_%d)
+static __inline void BITONIC_SORT_%d(SORT_TYPE *dst) {
+%s}
+""" % (n, n, n, swps)
+
+
+for n in range(2, max_network + 1):
+    if not check(n):
+        raise SystemExit("the network for %d elements does not sort" % n)
+
+header = """/* Copyright (c) 2010-2024 Christopher Swenson. */
+/* Copyright (c) 2012 Google Inc. All Rights Reserved. */
+
+/* Sorting networks for %d to %d elements, included by sort.h when SMALL_SORT_BND is
+   more than 16.  Written by generate_bitonic_sort.py, which says how they are made:
+   change that rather than this. */
+""" % (min_network, max_network)
+
+cases = "\n".join("  case %d:\n    BITONIC_SORT_%d(dst);\n    return 1;\n" % (n, n)
+                  for n in range(min_network, max_network + 1))
+
+footer = """
+/* Sorts dst with one of the networks above, if there is one for its size, and says
+   whether there was. */
+#define BITONIC_SORT_LARGE          SORT_MAKE_STR(bitonic_sort_large)
+static __inline int BITONIC_SORT_LARGE(SORT_TYPE *dst, const size_t size) {
+  switch (size) {
+%s
+  default:
+    return 0;
+  }
+}
+""" % cases
+
+with open('sort_networks.h', 'w') as F:
+    F.write(header)
+    F.write("".join(generate_network(n) for n in range(min_network, max_network + 1)))
+    F.write(footer)
+
+for n in range(min_network, max_network + 1):
+    print("%d: %d comparators in %d layers" % (n, len(network(n)), depth(network(n))))
+
+if shutil.which('astyle'):
+    os.system('astyle --options=astyle.options sort_networks.h')
@@ -42,6 +42,16 @@
 #define TIM_SORT_STACK_SIZE 128
 #endif
 
+/* Most buckets sample sort splits into at each level (a power of two, at least 4). */
+#ifndef SAMPLE_SORT_MAX_BUCKETS
+#define SAMPLE_SORT_MAX_BUCKETS 256
+#endif
+
+/* Ranges this small are left to quick sort. */
+#ifndef SAMPLE_SORT_BASE_CASE
+#define SAMPLE_SORT_BASE_CASE 4096
+#endif
+
 #ifndef SORT_SWAP
 #define SORT_SWAP(x,y) {SORT_TYPE _sort_swap_temp = (x); (x) = (y); (y) = _sort_swap_temp;}
 #endif
@@ -144,12 +154,108 @@ static __inline size_t rbnd(size_t len) {
   return 1ULL << ((2 * k) / 3);
 }
 
+/* Segmented sort gathers segments of at most SORT_SEGMENT_TINY elements (the
+   biggest sorting network) by size, SORT_SEGMENT_BATCH segments at a time. */
+#define SORT_SEGMENT_TINY 16
+#define SORT_SEGMENT_BATCH 256
+
+/* String sort sorts ranges this small by insertion. */
+#define SORT_STRING_SMALL 32
+
+/* The 8 characters of s from its start, as one big-endian word, so that words
+   compare the way the strings do; everything after the terminating NUL reads as
+   zero.  A word whose last byte is zero holds the whole rest of its string. */
+static __inline uint64_t sort_string_word(const unsigned char *s) {
+  uint64_t word = 0;
+  int i;
+
+  for (i = 0; (i < 8) && (s[i] != 0); i++) {
+    word |= (uint64_t)s[i] << (56 - 8 * i);
+  }
+
+  return word;
+}
+
+/* How many characters two different words have in common. */
+static __inline size_t sort_string_common(const uint64_t a, const uint64_t b) {
+  return (size_t)CLZ(a ^ b) >> 3;
+}
+
+/* How many characters a word holds before the NUL (8 if it has none). */
+static __inline size_t sort_string_length(uint64_t word) {
+  size_t length = 0;
+
+  while ((length < 8) && ((word >> 56) != 0)) {
+    word <<= 8;
+    length++;
+  }
+
+  return length;
+}
+
+/* Selection takes a Floyd-Rivest sample to find its pivot in ranges bigger than this. */
+#define SORT_SELECT_SAMPLE 600
+
+/* With SORT_BLOCK_PARTITION, quick sort looks for misplaced elements this many at a
+   time from each end (offsets in a block have to fit in an unsigned char). */
+#define QUICK_SORT_BLOCK 64
+
+/* With SORT_PDQSORT, quick sort takes the median of three medians of three for its
+   pivot in ranges bigger than QUICK_SORT_NINTHER, gives up on finishing a partition
+   that looks sorted by insertion after QUICK_SORT_PARTIAL_MOVES moves, and shuffles a
+   few elements of each side of a lopsided partition that has QUICK_SORT_SHUFFLE. */
+#define QUICK_SORT_NINTHER 128
+#define QUICK_SORT_PARTIAL_MOVES 8
+#define QUICK_SORT_SHUFFLE 24
+
+/* Floyd and Rivest's sample for selecting the i-th smallest of n elements: the
+   range [*lo, *hi], of about n^(2/3) / 2 elements around i, whose i - *lo-th
+   smallest should be very close to the i-th smallest of them all.  Their formula
+   with integer roots, so there's no need for libm. */
+static __inline void sort_select_sample(const size_t n, const size_t i, size_t *lo,
+                                        size_t *hi) {
+  const size_t lg = 64 - CLZ(n);
+  size_t cube = (size_t)1 << ((lg + 2) / 3);
+  size_t root, s, sd;
+
+  /* Newton's method from above for the cube root of n, and then for the square
+     root of s * ln(n), ln(n) being about 11/16 of lg(n) */
+  while (cube > n / cube / cube) {
+    cube = (2 * cube + n / cube / cube) / 3;
+  }
+
+  s = MAX(cube * cube / 2, 1);
+  root = s * lg;
+
+  while (root > s * lg * 11 / 16 / root) {
+    root = (root + s * lg * 11 / 16 / root) / 2;
+  }
+
+  sd = root / 2;
+
+  /* the window leans away from the middle, like sd * sign(i - n / 2) does */
+  if (i < n / 2) {
+    *lo = (i > i / (n / s) + sd) ? i - i / (n / s) - sd : 0;
+    *hi = MIN(i + (n - i) / (n / s) - sd, n - 1);
+  } else {
+    *lo = i - i / (n / s) + sd;
+    *hi = MIN(i + (n - i) / (n / s) + sd, n - 1);
+  }
+
+  *lo = MIN(*lo, i);
+  *hi = MAX(*hi, i);
+}
+
 #endif /* SORT_COMMON_H */
 
 #define SORT_CONCAT(x, y) x ## _ ## y
 #define SORT_MAKE_STR1(x, y) SORT_CONCAT(x,y)
 #define SORT_MAKE_STR(x) SORT_MAKE_STR1(SORT_NAME,x)
 
+/* Quick sort, in-place merge sort and the like hand ranges of up to SMALL_SORT_BND
+   elements to SMALL_SORT, and merge sort and tim sort to SMALL_STABLE_SORT.  All three
+   can be set for each SORT_TYPE; raising SMALL_SORT_BND (up to 64) past 16 brings in
+   the bigger sorting networks of sort_networks.h for BITONIC_SORT. */
 #ifndef SMALL_SORT_BND
 #define SMALL_SORT_BND 16
 #endif
@@ -170,6 +276,9 @@ static __inline size_t rbnd(size_t len) {
 #define BINARY_INSERTION_SORT_START    SORT_MAKE_STR(binary_insertion_sort_start)
 #define BINARY_INSERTION_SORT          SORT_MAKE_STR(binary_insertion_sort)
 #define REVERSE_ELEMENTS               SORT_MAKE_STR(reverse_elements)
+#define SORTED_UNTIL                   SORT_MAKE_STR(sorted_until)
+#define IS_SORTED_UNTIL                SORT_MAKE_STR(is_sorted_until)
+#define PRESORTED                      SORT_MAKE_STR(presorted)
 #define COUNT_RUN                      SORT_MAKE_STR(count_run)
 #define CHECK_INVARIANT                SORT_MAKE_STR(check_invariant)
 #define TIM_SORT                       SORT_MAKE_STR(tim_sort)
@@ -187,13 +296,85 @@ static __inline size_t rbnd(size_t len) {
 #define MERGE_SORT_IN_PLACE_FRONTMERGE SORT_MAKE_STR(merge_sort_in_place_frontmerge)
 #define MERGE_SORT_IN_PLACE_ASWAP      SORT_MAKE_STR(merge_sort_in_place_aswap)
 #define SHELL_SORT                     SORT_MAKE_STR(shell_sort)
+#define SHELL_SORT_PASS                SORT_MAKE_STR(shell_sort_pass)
 #define QUICK_SORT_PARTITION           SORT_MAKE_STR(quick_sort_partition)
+#define QUICK_SORT_BLOCK_PARTITION     SORT_MAKE_STR(quick_sort_block_partition)
 #define QUICK_SORT_RECURSIVE           SORT_MAKE_STR(quick_sort_recursive)
+#define QUICK_SORT_SORT3               SORT_MAKE_STR(quick_sort_sort3)
+#define QUICK_SORT_PARTIAL_INSERTION   SORT_MAKE_STR(quick_sort_partial_insertion)
+#define QUICK_SORT_PARTITION_EQUAL     SORT_MAKE_STR(quick_sort_partition_equal)
+#define QUICK_SORT_PDQ                 SORT_MAKE_STR(quick_sort_pdq)
+#define QUICK_SORT_PARTITION3          SORT_MAKE_STR(quick_sort_partition3)
 #define HEAP_SIFT_DOWN                 SORT_MAKE_STR(heap_sift_down)
 #define HEAPIFY                        SORT_MAKE_STR(heapify)
 #define TIM_SORT_RUN_T                 SORT_MAKE_STR(tim_sort_run_t)
 #define TEMP_STORAGE_T                 SORT_MAKE_STR(temp_storage_t)
 #define PUSH_NEXT                      SORT_MAKE_STR(push_next)
+#define SAMPLE_SORT                    SORT_MAKE_STR(sample_sort)
+#define SAMPLE_SORT_RECURSIVE          SORT_MAKE_STR(sample_sort_recursive)
+#define SAMPLE_SORT_BUILD              SORT_MAKE_STR(sample_sort_build)
+#define SAMPLE_SORT_BUILD_TREE         SORT_MAKE_STR(sample_sort_build_tree)
+#define SAMPLE_SORT_CLASSIFY           SORT_MAKE_STR(sample_sort_classify)
+#define SAMPLE_SORT_PUSH               SORT_MAKE_STR(sample_sort_push)
+#define SAMPLE_SORT_LOCAL              SORT_MAKE_STR(sample_sort_local)
+#define SAMPLE_SORT_SPILL              SORT_MAKE_STR(sample_sort_spill)
+#define SAMPLE_SORT_PUT                SORT_MAKE_STR(sample_sort_put)
+#define SAMPLE_SORT_CLEANUP            SORT_MAKE_STR(sample_sort_cleanup)
+#define SAMPLE_SORT_PARTITION          SORT_MAKE_STR(sample_sort_partition)
+#define SAMPLE_SORT_INIT               SORT_MAKE_STR(sample_sort_init)
+#define SAMPLE_SORT_CLASSIFIER_T       SORT_MAKE_STR(sample_sort_classifier_t)
+#define SAMPLE_SORT_BUFFERS_T          SORT_MAKE_STR(sample_sort_buffers_t)
+#define SAMPLE_SORT_T                  SORT_MAKE_STR(sample_sort_t)
+#define RADIX_SORT                     SORT_MAKE_STR(radix_sort)
+#define RADIX_SORT_KEY                 SORT_MAKE_STR(radix_sort_key)
+#define RADIX_SORT_INSERTION           SORT_MAKE_STR(radix_sort_insertion)
+#define RADIX_SORT_HISTOGRAM           SORT_MAKE_STR(radix_sort_histogram)
+#define RADIX_SORT_SCATTER             SORT_MAKE_STR(radix_sort_scatter)
+#define TOP_K                          SORT_MAKE_STR(top_k)
+#define TOP_K_SELECT                   SORT_MAKE_STR(top_k_select)
+#define TOP_K_UNSORTED                 SORT_MAKE_STR(top_k_unsorted)
+#define STRING_SORT                    SORT_MAKE_STR(string_sort)
+#define STRING_SORT_LCP                SORT_MAKE_STR(string_sort_lcp)
+#define STRING_SORT_LOAD               SORT_MAKE_STR(string_sort_load)
+#define STRING_SORT_PARTITION          SORT_MAKE_STR(string_sort_partition)
+#define STRING_SORT_INSERTION          SORT_MAKE_STR(string_sort_insertion)
+#define STRING_SORT_MKQS               SORT_MAKE_STR(string_sort_mkqs)
+#define SORT_UNIQUE                    SORT_MAKE_STR(sort_unique)
+#define SORT_GROUPS                    SORT_MAKE_STR(sort_groups)
+#define SORT_UNIQUE_MERGE              SORT_MAKE_STR(sort_unique_merge)
+#define SORT_UNIQUE_RUN                SORT_MAKE_STR(sort_unique_run)
+#define NTH_ELEMENT                    SORT_MAKE_STR(nth_element)
+#define NTH_ELEMENT_RANGE              SORT_MAKE_STR(nth_element_range)
+#define NTH_ELEMENT_PIVOT              SORT_MAKE_STR(nth_element_pivot)
+#define KWAY_MERGE                     SORT_MAKE_STR(kway_merge)
+#define KWAY_MERGE_LESS                SORT_MAKE_STR(kway_merge_less)
+#define SEGMENTED_SORT                 SORT_MAKE_STR(segmented_sort)
+#define STABLE_SEGMENTED_SORT          SORT_MAKE_STR(stable_segmented_sort)
+#define SEGMENTED_SORT_RANGE           SORT_MAKE_STR(segmented_sort_range)
+#define SEGMENTED_SORT_NEW_BUFFER      SORT_MAKE_STR(segmented_sort_new_buffer)
+
+/* sample sort moves elements around in blocks of about 2KB */
+#define SAMPLE_SORT_BLOCK (sizeof(SORT_TYPE) < 2048 ? 2048 / sizeof(SORT_TYPE) : 1)
+#define SAMPLE_SORT_ROUND(x) (((x) + SAMPLE_SORT_BLOCK - 1) / SAMPLE_SORT_BLOCK * SAMPLE_SORT_BLOCK)
+
+/* What radix sort needs to know about a SORT_PRIMITIVE type; SORT_RADIX_LINE is
+   how many elements fill a cache line. */
+#define SORT_RADIX_INTEGER (((SORT_TYPE)1 / 2 == 0) && (sizeof(SORT_TYPE) <= 8))
+#define SORT_RADIX_FLOAT (((SORT_TYPE)1 / 2 != 0) && \
+  ((sizeof(SORT_TYPE) == 4) || (sizeof(SORT_TYPE) == 8)))
+#define SORT_RADIX_SIGNED ((SORT_TYPE)-1 < (SORT_TYPE)1)
+#define SORT_RADIX_LINE (sizeof(SORT_TYPE) < 64 ? 64 / sizeof(SORT_TYPE) : 1)
+
+#ifdef SORT_PRIMITIVE
+#include "sort_simd.h"
+
+/* Which SIMD kernels take SORT_TYPE, going by its size and what kind of number it is. */
+#define SORT_SIMD_KIND (sizeof(SORT_TYPE) == 4 ? \
+  (!SORT_RADIX_INTEGER ? SORT_SIMD_F32 : SORT_RADIX_SIGNED ? SORT_SIMD_I32 : SORT_SIMD_U32) : \
+  sizeof(SORT_TYPE) == 8 ? \
+  (!SORT_RADIX_INTEGER ? SORT_SIMD_F64 : SORT_RADIX_SIGNED ? SORT_SIMD_I64 : SORT_SIMD_U64) : \
+  SORT_SIMD_NONE)
+#endif
 
 #ifndef MAX
 #define MAX(x,y) (((x) > (y) ? (x) : (y)))
@@ -219,11 +400,29 @@ SORT_DEF void MERGE_SORT(SORT_TYPE *dst, const size_t size);
 SORT_DEF void MERGE_SORT_IN_PLACE(SORT_TYPE *dst, const size_t size);
 SORT_DEF void TIM_SORT(SORT_TYPE *dst, const size_t size);
 SORT_DEF void BITONIC_SORT(SORT_TYPE *dst, const size_t size);
+SORT_DEF void SAMPLE_SORT(SORT_TYPE *dst, const size_t size);
+SORT_DEF size_t TOP_K(SORT_TYPE *src, const size_t size, const size_t k, SORT_TYPE *out);
+SORT_DEF void NTH_ELEMENT(SORT_TYPE *dst, const size_t size, const size_t nth);
+SORT_DEF void KWAY_MERGE(SORT_TYPE **inputs, const size_t *lens, const size_t k, SORT_TYPE *out);
+SORT_DEF size_t SORT_UNIQUE(SORT_TYPE *dst, const size_t size);
+SORT_DEF size_t SORT_GROUPS(SORT_TYPE *dst, const size_t size, size_t *starts);
+SORT_DEF void SEGMENTED_SORT(SORT_TYPE *data, const size_t *offsets, const size_t nsegments);
+SORT_DEF void STABLE_SEGMENTED_SORT(SORT_TYPE *data, const size_t *offsets,
+                                    const size_t nsegments);
+SORT_DEF size_t IS_SORTED_UNTIL(SORT_TYPE *dst, const size_t size);
+#ifdef SORT_PRIMITIVE
+SORT_DEF void RADIX_SORT(SORT_TYPE *dst, const size_t size);
+#endif
+#ifdef SORT_STRING
+SORT_DEF void STRING_SORT(SORT_TYPE *dst, const size_t size);
+SORT_DEF void STRING_SORT_LCP(SORT_TYPE *dst, const size_t size, size_t *lcp);
+#endif
 
 /* The full implementation of a bitonic sort is not here. Since we only want to use
    sorting networks for small length lists we create optimal sorting networks for
    lists of length <= 16 and call out to BINARY_INSERTION_SORT for anything larger
-   than 16.
+   than 16 (unless SORT_PRIMITIVE keys fit in a SIMD network, see sort_simd.h, or
+   SMALL_SORT_BND brings in the networks for up to 64 in sort_networks.h).
    Optimal sorting networks for small length lists.
    Taken from https://pages.ripco.net/~jgamble/nw.html */
 #define BITONIC_SORT_2          SORT_MAKE_STR(bitonic_sort_2)
@@ -705,7 +904,20 @@ static __inline void BITONIC_SORT_16(SORT_TYPE *dst) {
   SORT_CSWAP(dst[8], dst[9]);
 }
 
+#if SMALL_SORT_BND > 16
+#include "sort_networks.h"
+#endif
+
 SORT_DEF void BITONIC_SORT(SORT_TYPE *dst, const size_t size) {
+#ifdef SORT_PRIMITIVE
+
+  /* primitive keys sort faster all at once in SIMD registers */
+  if (sort_simd_network(SORT_SIMD_KIND, dst, size)) {
+    return;
+  }
+
+#endif
+
   switch (size) {
   case 0:
   case 1:
@@ -772,6 +984,13 @@ SORT_DEF void BITONIC_SORT(SORT_TYPE *dst, const size_t size) {
     break;
 
   default:
+#if SMALL_SORT_BND > 16
+
+    if (BITONIC_SORT_LARGE(dst, size)) {
+      break;
+    }
+
+#endif
     BINARY_INSERTION_SORT(dst, size);
   }
 }
@@ -825,27 +1044,89 @@ SORT_DEF void SORT_DELETE_BUFFER(SORT_TYPE* pointer) {
 #endif
 }
 
+static __inline void REVERSE_ELEMENTS(SORT_TYPE *dst, size_t start, size_t end) {
+  while (1) {
+    if (start >= end) {
+      return;
+    }
+
+    SORT_SWAP(dst[start], dst[end]);
+    start++;
+    end--;
+  }
+}
 
-/* Shell sort implementation based on Wikipedia article
-   http://en.wikipedia.org/wiki/Shell_sort
-*/
-SORT_DEF void SHELL_SORT(SORT_TYPE *dst, const size_t size) {
-  /* don't bother sorting an array of size 0 or 1 */
-  /* TODO: binary search to find first gap? */
-  int inci = 47;
-  size_t inc = shell_gaps[inci];
+/* The first element of dst that is less than the one before it, or if reversed is
+   set the first that isn't, or size if there is none.  SORT_PRIMITIVE keys are
+   compared a vector at a time with the vector one key further down. */
+static __inline size_t SORTED_UNTIL(SORT_TYPE *dst, const size_t size, const int reversed) {
   size_t i;
+#ifdef SORT_PRIMITIVE
+  i = sort_simd_sorted_until(SORT_SIMD_KIND, dst, size, reversed);
+
+  if (i != SIZE_MAX) {
+    return i;
+  }
+
+#endif
 
   if (size <= 1) {
-    return;
+    return size;
   }
 
-  while (inc > (size >> 1)) {
-    inc = shell_gaps[--inci];
+  i = 1;
+
+  if (reversed) {
+    while ((i < size) && (SORT_CMP(dst[i - 1], dst[i]) > 0)) {
+      i++;
+    }
+  } else {
+    while ((i < size) && (SORT_CMP(dst[i - 1], dst[i]) <= 0)) {
+      i++;
+    }
   }
 
-  while (1) {
-    for (i = inc; i < size; i++) {
+  return i;
+}
+
+/* The index of the first element of dst that is less than the one before it, or
+   size if dst is sorted. */
+SORT_DEF size_t IS_SORTED_UNTIL(SORT_TYPE *dst, const size_t size) {
+  return SORTED_UNTIL(dst, size, 0);
+}
+
+/* Whether dst is sorted already, or was strictly descending and has been reversed:
+   the sorts check for both first, since that takes about as long as reading dst
+   once and gives up as soon as two elements show it isn't so. */
+static __inline int PRESORTED(SORT_TYPE *dst, const size_t size) {
+  if (SORTED_UNTIL(dst, size, 0) == size) {
+    return 1;
+  }
+
+  if (SORTED_UNTIL(dst, size, 1) == size) {
+    REVERSE_ELEMENTS(dst, 0, size - 1);
+    return 1;
+  }
+
+  return 0;
+}
+
+
+/* Shell sort implementation based on Wikipedia article
+   http://en.wikipedia.org/wiki/Shell_sort
+*/
+/* Insertion sort the chains first to last - 1 of gap inc, where chain c is
+   dst[c], dst[c + inc], ...; chains don't touch each other, so disjoint ranges of
+   them can be sorted at the same time.  Goes through dst row by row (a row being
+   inc elements) so the elements next to each other are handled together. */
+static __inline void SHELL_SORT_PASS(SORT_TYPE *dst, const size_t size, const size_t inc,
+                                     const size_t first, const size_t last) {
+  size_t row, i;
+
+  for (row = inc; row < size; row += inc) {
+    const size_t end = MIN(row + last, size);
+
+    for (i = row + first; i < end; i++) {
       SORT_TYPE temp = dst[i];
       size_t j = i;
 
@@ -856,6 +1137,25 @@ SORT_DEF void SHELL_SORT(SORT_TYPE *dst, const size_t size) {
 
       dst[j] = temp;
     }
+  }
+}
+
+SORT_DEF void SHELL_SORT(SORT_TYPE *dst, const size_t size) {
+  /* don't bother sorting an array of size 0 or 1 */
+  /* TODO: binary search to find first gap? */
+  int inci = 47;
+  size_t inc = shell_gaps[inci];
+
+  if ((size <= 1) || PRESORTED(dst, size)) {
+    return;
+  }
+
+  while (inc > (size >> 1)) {
+    inc = shell_gaps[--inci];
+  }
+
+  while (1) {
+    SHELL_SORT_PASS(dst, size, inc, 0, inc);
 
     if (inc == 1) {
       break;
@@ -1184,25 +1484,28 @@ SORT_DEF void MERGE_SORT_RECURSIVE(SORT_TYPE *newdst, SORT_TYPE *dst, const size
   MERGE_SORT_RECURSIVE(newdst, dst, middle);
   MERGE_SORT_RECURSIVE(newdst, &dst[middle], size - middle);
 
-  while (out != size) {
-    if (i < middle) {
-      if (j < size) {
-        if (SORT_CMP(dst[i], dst[j]) <= 0) {
-          newdst[out] = dst[i++];
-        } else {
-          newdst[out] = dst[j++];
-        }
-      } else {
-        newdst[out] = dst[i++];
-      }
+  /* nothing to do if the halves are already in order */
+  if (SORT_CMP(dst[middle - 1], dst[middle]) <= 0) {
+    return;
+  }
+
+#ifdef SORT_PRIMITIVE
+  /* integer keys merge a few vectors at a time, up to the last few */
+  out = sort_simd_merge(SORT_SIMD_KIND, 0, newdst, dst, middle, &dst[middle], size - middle, &i);
+  j = middle + out - i;
+#endif
+
+  while ((i < middle) && (j < size)) {
+    if (SORT_CMP(dst[i], dst[j]) <= 0) {
+      newdst[out++] = dst[i++];
     } else {
-      newdst[out] = dst[j++];
+      newdst[out++] = dst[j++];
     }
-
-    out++;
   }
 
-  SORT_TYPE_CPY(dst, newdst, size);
+  /* whatever is left of the second half is already in place */
+  SORT_TYPE_CPY(&newdst[out], &dst[i], middle - i);
+  SORT_TYPE_CPY(dst, newdst, out + middle - i);
 }
 
 /* Standard merge sort */
@@ -1219,22 +1522,121 @@ SORT_DEF void MERGE_SORT(SORT_TYPE *dst, const size_t size) {
     return;
   }
 
+  /* a strictly descending run has no equal elements to keep in order */
+  if (PRESORTED(dst, size)) {
+    return;
+  }
+
   newdst = SORT_NEW_BUFFER(size);
   MERGE_SORT_RECURSIVE(newdst, dst, size);
   SORT_DELETE_BUFFER(newdst);
 }
 
 
+#ifdef SORT_BLOCK_PARTITION
+
+/* Partition [*left, *right) around value in blocks, after Edelkamp and Weiss's
+   BlockQuicksort: the offsets of the elements that are on the wrong side go into
+   a buffer for each end without branching on the comparisons, and then as many
+   pairs of them as there are are swapped.  Elements less than value end up before
+   *left and the rest from *right on, leaving at most two blocks between them. */
+static __inline void QUICK_SORT_BLOCK_PARTITION(SORT_TYPE *dst, size_t *left, size_t *right,
+    const SORT_TYPE value, int *not_all_same) {
+  unsigned char offsets_left[QUICK_SORT_BLOCK], offsets_right[QUICK_SORT_BLOCK];
+  size_t l = *left, r = *right;
+  size_t num_left = 0, num_right = 0, start_left = 0, start_right = 0;
+  size_t i, n;
+  int cmp, mixed = 0;
+
+  while (r - l > 2 * QUICK_SORT_BLOCK) {
+    if (num_left == 0) {
+      start_left = 0;
+
+      for (i = 0; i < QUICK_SORT_BLOCK; i++) {
+        cmp = SORT_CMP(dst[l + i], value);
+        mixed |= cmp;
+        offsets_left[num_left] = (unsigned char) i;
+        num_left += cmp >= 0;
+      }
+    }
+
+    if (num_right == 0) {
+      start_right = 0;
+
+      for (i = 0; i < QUICK_SORT_BLOCK; i++) {
+        cmp = SORT_CMP(dst[r - 1 - i], value);
+        mixed |= cmp;
+        offsets_right[num_right] = (unsigned char) i;
+        num_right += cmp < 0;
+      }
+    }
+
+    n = MIN(num_left, num_right);
+
+    for (i = 0; i < n; i++) {
+      SORT_SWAP(dst[l + offsets_left[start_left + i]], dst[r - 1 - offsets_right[start_right + i]]);
+    }
+
+    num_left -= n;
+    num_right -= n;
+    start_left += n;
+    start_right += n;
+
+    /* a block is done with once it has nothing left on the wrong side */
+    if (num_left == 0) {
+      l += QUICK_SORT_BLOCK;
+    }
+
+    if (num_right == 0) {
+      r -= QUICK_SORT_BLOCK;
+    }
+  }
+
+  *left = l;
+  *right = r;
+  *not_all_same |= mixed;
+}
+
+#endif
+
 static __inline size_t QUICK_SORT_PARTITION(SORT_TYPE *dst, const size_t left,
     const size_t right, const size_t pivot) {
   SORT_TYPE value = dst[pivot];
   size_t index = left;
+  size_t end = right;
   size_t i;
   int not_all_same = 0;
   /* move the pivot to the right */
   SORT_SWAP(dst[pivot], dst[right]);
+#ifdef SORT_PRIMITIVE
+  /* primitive keys are compared with the pivot a whole vector at a time */
+  i = sort_simd_partition(SORT_SIMD_KIND, &dst[left], right - left, &value);
+
+  if (i != SIZE_MAX) {
+    index = left + i;
+    SORT_SWAP(dst[right], dst[index]);
+
+    if (index > left) {
+      return index;
+    }
+
+    /* nothing was less; check if everything is all the same */
+    for (i = left + 1; i <= right; i++) {
+      if (SORT_CMP(dst[i], value) != 0) {
+        return index;
+      }
+    }
+
+    return SIZE_MAX;
+  }
+
+#endif
+#ifdef SORT_BLOCK_PARTITION
+  /* all but the last two blocks without a branch on the comparisons */
+  QUICK_SORT_BLOCK_PARTITION(dst, &index, &end, value, &not_all_same);
+#endif
 
-  for (i = left; i < right; i++) {
+  for (i = index; i < end; i++) {
     int cmp = SORT_CMP(dst[i], value);
     /* check if everything is all the same */
     not_all_same |= cmp;
@@ -1255,37 +1657,70 @@ static __inline size_t QUICK_SORT_PARTITION(SORT_TYPE *dst, const size_t left,
   return index;
 }
 
-/* Based on Knuth vol. 3
-static __inline size_t QUICK_SORT_HOARE_PARTITION(SORT_TYPE *dst, const size_t l,
-    const size_t r, const size_t pivot) {
-  SORT_TYPE value;
-  size_t i = l + 1;
-  size_t j = r;
 
-  if (pivot != l) {
-    SORT_SWAP(dst[pivot], dst[l]);
-  }
-  value = dst[l];
+#ifdef SORT_FAT_PARTITION
+
+/* Bentley and McIlroy's three-way partition of dst[left, right] around dst[pivot]:
+   the elements less than it end up in [left, *lt), the ones equal to it in
+   [*lt, *gt] and the bigger ones in (*gt, right].  Equal elements met along the way
+   are put aside at either end, and swapped into the middle at the end, so keys that
+   are all different cost no more swaps than a two-way partition. */
+static __inline void QUICK_SORT_PARTITION3(SORT_TYPE *dst, const size_t left,
+    const size_t right, const size_t pivot, size_t *lt, size_t *gt) {
+  SORT_TYPE value;
+  size_t a = left + 1U, b = left + 1U, c = right, d = right;
+  size_t n, i;
+  int cmp;
+  /* move the pivot to the left, where it joins the equal elements */
+  SORT_SWAP(dst[pivot], dst[left]);
+  value = dst[left];
 
   while (1) {
-    while (SORT_CMP(dst[i], value) < 0) {
-      i++;
+    while ((b <= c) && ((cmp = SORT_CMP(dst[b], value)) <= 0)) {
+      if (cmp == 0) {
+        SORT_SWAP(dst[a], dst[b]);
+        a++;
+      }
+
+      b++;
     }
-    while (SORT_CMP(value, dst[j]) < 0) {
-      j--;
+
+    while ((c >= b) && ((cmp = SORT_CMP(dst[c], value)) >= 0)) {
+      if (cmp == 0) {
+        SORT_SWAP(dst[c], dst[d]);
+        d--;
+      }
+
+      c--;
     }
-    if (j <= i) {
-      SORT_SWAP(dst[l], dst[j]);
-      return j;
+
+    if (b > c) {
+      break;
     }
-    SORT_SWAP(dst[i], dst[j]);
-    i++;
-    j--;
+
+    SORT_SWAP(dst[b], dst[c]);
+    b++;
+    c--;
   }
-  return 0;
+
+  /* [left, a) and (d, right] are equal, [a, b) less and (c, d] bigger */
+  n = MIN(a - left, b - a);
+
+  for (i = 0; i < n; i++) {
+    SORT_SWAP(dst[left + i], dst[b - n + i]);
+  }
+
+  n = MIN(d - c, right - d);
+
+  for (i = 0; i < n; i++) {
+    SORT_SWAP(dst[b + i], dst[right + 1U - n + i]);
+  }
+
+  *lt = left + (b - a);
+  *gt = right - (d - c);
 }
-*/
 
+#endif
 
 /* Return the median index of the objects at the three indices. */
 static __inline size_t MEDIAN(const SORT_TYPE *dst, const size_t a, const size_t b,
@@ -1333,51 +1768,258 @@ static __inline size_t MEDIAN(const SORT_TYPE *dst, const size_t a, const size_t
   }
 }
 
-static void QUICK_SORT_RECURSIVE(SORT_TYPE *dst, const size_t original_left,
-                                 const size_t original_right) {
+#ifdef SORT_PDQSORT
+
+/* Put dst[a], dst[b] and dst[c] in order. */
+static __inline void QUICK_SORT_SORT3(SORT_TYPE *dst, const size_t a, const size_t b,
+                                      const size_t c) {
+  SORT_CSWAP(dst[a], dst[b]);
+  SORT_CSWAP(dst[b], dst[c]);
+  SORT_CSWAP(dst[a], dst[b]);
+}
+
+/* Insertion sort dst[0, size), unless that takes more than QUICK_SORT_PARTIAL_MOVES
+   moves in all; then stop there and return 0. */
+static __inline int QUICK_SORT_PARTIAL_INSERTION(SORT_TYPE *dst, const size_t size) {
+  size_t moves = 0;
+  size_t i, j;
+  SORT_TYPE x;
+
+  for (i = 1; i < size; i++) {
+    if (SORT_CMP(dst[i], dst[i - 1]) >= 0) {
+      continue;
+    }
+
+    x = dst[i];
+    j = i;
+
+    do {
+      dst[j] = dst[j - 1];
+      j--;
+    } while ((j > 0) && (SORT_CMP(x, dst[j - 1]) < 0));
+
+    dst[j] = x;
+    moves += i - j;
+
+    if (moves > QUICK_SORT_PARTIAL_MOVES) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/* Nothing in dst[left, right] is less than dst[left - 1], the pivot that cut the range
+   off: move the elements equal to it to the front, where they are done with, and
+   return where the rest start. */
+static __inline size_t QUICK_SORT_PARTITION_EQUAL(SORT_TYPE *dst, const size_t left,
+    const size_t right) {
+  size_t index = left;
+  size_t i;
+
+  for (i = left; i <= right; i++) {
+    if (SORT_CMP(dst[i], dst[left - 1]) <= 0) {
+      SORT_SWAP(dst[i], dst[index]);
+      index++;
+    }
+  }
+
+  return index;
+}
+
+/* Orson Peters's pattern-defeating quicksort: it finishes partitions that come out
+   of input in order already by insertion, sorts runs of elements equal to the last
+   pivot in one pass, and breaks up the patterns that give it lopsided partitions
+   by swapping a few elements of each side; only if that keeps happening does it
+   switch to heap sort.  bad_allowed is how many more lopsided partitions the whole
+   sort may have, shared with the recursive calls so that it caps them all at
+   O(n log n). */
+static void QUICK_SORT_PDQ(SORT_TYPE *dst, const size_t original_left,
+                           const size_t original_right, int bad_allowed) {
   size_t left;
   size_t right;
-  size_t pivot;
-  size_t new_pivot;
+  size_t size;
   size_t middle;
-  int loop_count = 0;
-  const int max_loops = 64 - CLZ(original_right - original_left); /* ~lg N */
+  size_t first;
+  size_t last;
+  size_t new_pivot;
+  size_t l_size;
+  size_t r_size;
+  int partitioned;
   left = original_left;
   right = original_right;
 
   while (1) {
-    if (right <= left) {
+    size = right - left + 1U;
+
+    if (size <= SMALL_SORT_BND) {
+      SMALL_SORT(&dst[left], size);
       return;
     }
 
-    if ((right - left + 1U) <= SMALL_SORT_BND) {
-      SMALL_SORT(&dst[left], right - left + 1U);
-      return;
+    /* median of 3, or of 3 medians of 3 */
+    middle = left + size / 2;
+    QUICK_SORT_SORT3(dst, left, middle, right);
+
+    if (size > QUICK_SORT_NINTHER) {
+      QUICK_SORT_SORT3(dst, left + 1U, middle - 1U, right - 1U);
+      QUICK_SORT_SORT3(dst, left + 2U, middle + 1U, right - 2U);
+      QUICK_SORT_SORT3(dst, middle - 1U, middle, middle + 1U);
     }
 
-    if (++loop_count >= max_loops) {
-      /* we have recursed / looped too many times; switch to heap sort */
-      HEAP_SORT(&dst[left], right - left + 1U);
-      return;
+    /* a pivot no bigger than the one before the range is equal to it */
+    if ((left > 0) && (SORT_CMP(dst[left - 1U], dst[middle]) >= 0)) {
+      left = QUICK_SORT_PARTITION_EQUAL(dst, left, right);
+      continue;
     }
 
-    /* median of 5 */
-    middle = left + ((right - left) >> 1);
-    pivot = MEDIAN((const SORT_TYPE *) dst, left, middle, right);
-    pivot = MEDIAN((const SORT_TYPE *) dst, left + ((middle - left) >> 1), pivot,
-                   middle + ((right - middle) >> 1));
-    new_pivot = QUICK_SORT_PARTITION(dst, left, right, pivot);
+    /* skip what is on the right side of the pivot already at each end, and if
+       that is everything, there is no need to partition */
+    SORT_SWAP(dst[left], dst[middle]);
+    first = left + 1U;
 
-    /* check for partition all equal */
-    if (new_pivot == SIZE_MAX) {
+    while ((first <= right) && (SORT_CMP(dst[first], dst[left]) < 0)) {
+      first++;
+    }
+
+    last = right;
+
+    while ((last >= first) && (SORT_CMP(dst[last], dst[left]) >= 0)) {
+      last--;
+    }
+
+    partitioned = last < first;
+    SORT_SWAP(dst[left], dst[first - 1U]);
+    new_pivot = partitioned ? first - 1U : QUICK_SORT_PARTITION(dst, first - 1U, last,
+                first - 1U);
+    l_size = new_pivot - left;
+    r_size = right - new_pivot;
+
+    if ((l_size < size / 8) || (r_size < size / 8)) {
+      if (--bad_allowed <= 0) {
+        /* too many lopsided partitions; switch to heap sort */
+        HEAP_SORT(&dst[left], size);
+        return;
+      }
+
+      if (l_size >= QUICK_SORT_SHUFFLE) {
+        SORT_SWAP(dst[left], dst[left + l_size / 4]);
+        SORT_SWAP(dst[new_pivot - 1U], dst[new_pivot - l_size / 4]);
+
+        if (l_size > QUICK_SORT_NINTHER) {
+          SORT_SWAP(dst[left + 1U], dst[left + l_size / 4 + 1U]);
+          SORT_SWAP(dst[left + 2U], dst[left + l_size / 4 + 2U]);
+          SORT_SWAP(dst[new_pivot - 2U], dst[new_pivot - l_size / 4 - 1U]);
+          SORT_SWAP(dst[new_pivot - 3U], dst[new_pivot - l_size / 4 - 2U]);
+        }
+      }
+
+      if (r_size >= QUICK_SORT_SHUFFLE) {
+        SORT_SWAP(dst[new_pivot + 1U], dst[new_pivot + 1U + r_size / 4]);
+        SORT_SWAP(dst[right], dst[right + 1U - r_size / 4]);
+
+        if (r_size > QUICK_SORT_NINTHER) {
+          SORT_SWAP(dst[new_pivot + 2U], dst[new_pivot + 2U + r_size / 4]);
+          SORT_SWAP(dst[new_pivot + 3U], dst[new_pivot + 3U + r_size / 4]);
+          SORT_SWAP(dst[right - 1U], dst[right - r_size / 4]);
+          SORT_SWAP(dst[right - 2U], dst[right - 1U - r_size / 4]);
+        }
+      }
+    } else if (partitioned && QUICK_SORT_PARTIAL_INSERTION(&dst[left], l_size) &&
+               QUICK_SORT_PARTIAL_INSERTION(&dst[new_pivot + 1U], r_size)) {
       return;
     }
 
     /* recurse only on the small part to avoid degenerate stack sizes */
     /* and manually do tail call on the large part */
-    if (new_pivot - 1U - left > right - new_pivot - 1U) {
-      /* left is bigger than right */
-      QUICK_SORT_RECURSIVE(dst, new_pivot + 1U, right);
+    if (l_size > r_size) {
+      if (r_size > 1) {
+        QUICK_SORT_PDQ(dst, new_pivot + 1U, right, bad_allowed);
+      }
+
+      right = new_pivot - 1U;
+    } else {
+      if (l_size > 1) {
+        QUICK_SORT_PDQ(dst, left, new_pivot - 1U, bad_allowed);
+      }
+
+      left = new_pivot + 1U;
+    }
+  }
+}
+
+static void QUICK_SORT_RECURSIVE(SORT_TYPE *dst, const size_t left, const size_t right) {
+  QUICK_SORT_PDQ(dst, left, right, 64 - CLZ(right - left)); /* ~lg N */
+}
+
+#else
+
+static void QUICK_SORT_RECURSIVE(SORT_TYPE *dst, const size_t original_left,
+                                 const size_t original_right) {
+  size_t left;
+  size_t right;
+  size_t pivot;
+  size_t middle;
+#ifdef SORT_FAT_PARTITION
+  size_t lt, gt;
+#else
+  size_t new_pivot;
+#endif
+  int loop_count = 0;
+  const int max_loops = 64 - CLZ(original_right - original_left); /* ~lg N */
+  left = original_left;
+  right = original_right;
+
+  while (1) {
+    if (right <= left) {
+      return;
+    }
+
+    if ((right - left + 1U) <= SMALL_SORT_BND) {
+      SMALL_SORT(&dst[left], right - left + 1U);
+      return;
+    }
+
+    if (++loop_count >= max_loops) {
+      /* we have recursed / looped too many times; switch to heap sort */
+      HEAP_SORT(&dst[left], right - left + 1U);
+      return;
+    }
+
+    /* median of 5 */
+    middle = left + ((right - left) >> 1);
+    pivot = MEDIAN((const SORT_TYPE *) dst, left, middle, right);
+    pivot = MEDIAN((const SORT_TYPE *) dst, left + ((middle - left) >> 1), pivot,
+                   middle + ((right - middle) >> 1));
+#ifdef SORT_FAT_PARTITION
+    QUICK_SORT_PARTITION3(dst, left, right, pivot, &lt, &gt);
+
+    /* the elements equal to the pivot are done with: recurse only on the smaller
+       of the other two parts, and tail call on the bigger */
+    if (lt - left > right - gt) {
+      QUICK_SORT_RECURSIVE(dst, gt + 1U, right);
+      right = lt - 1U;
+    } else {
+      if (lt > left) {
+        QUICK_SORT_RECURSIVE(dst, left, lt - 1U);
+      }
+
+      left = gt + 1U;
+    }
+
+#else
+    new_pivot = QUICK_SORT_PARTITION(dst, left, right, pivot);
+
+    /* check for partition all equal */
+    if (new_pivot == SIZE_MAX) {
+      return;
+    }
+
+    /* recurse only on the small part to avoid degenerate stack sizes */
+    /* and manually do tail call on the large part */
+    if (new_pivot - 1U - left > right - new_pivot - 1U) {
+      /* left is bigger than right */
+      QUICK_SORT_RECURSIVE(dst, new_pivot + 1U, right);
       /* tail call for left */
       right = new_pivot - 1U;
     } else {
@@ -1386,12 +2028,16 @@ static void QUICK_SORT_RECURSIVE(SORT_TYPE *dst, const size_t original_left,
       /* tail call for right */
       left = new_pivot + 1U;
     }
+
+#endif
   }
 }
 
+#endif
+
 void QUICK_SORT(SORT_TYPE *dst, const size_t size) {
-  /* don't bother sorting an array of size 1 */
-  if (size <= 1) {
+  /* don't bother sorting an array of size 1, or one that is in order already */
+  if ((size <= 1) || PRESORTED(dst, size)) {
     return;
   }
 
@@ -1399,384 +2045,1620 @@ void QUICK_SORT(SORT_TYPE *dst, const size_t size) {
 }
 
 
-/* timsort implementation, based on timsort.txt */
 
-static __inline void REVERSE_ELEMENTS(SORT_TYPE *dst, size_t start, size_t end) {
-  while (1) {
-    if (start >= end) {
+/* top k: the k largest elements of src, found in a single pass.  Candidates go
+   into a buffer of 2k; whenever it fills up, quickselect keeps the k largest and
+   the smallest of those becomes the bar every later element has to beat, so most
+   elements are looked at once and never moved. */
+
+/* Rearrange dst so that dst[nth] is what it would be if dst were sorted, with
+   nothing bigger before it and nothing smaller after it. */
+static void TOP_K_SELECT(SORT_TYPE *dst, const size_t size, const size_t nth) {
+  size_t left = 0;
+  size_t right = size - 1;
+  size_t pivot, middle, new_pivot;
+  int loop_count = 0;
+  const int max_loops = 64 - CLZ(size); /* ~lg N */
+
+  while (right > left) {
+    if (right - left + 1U <= SMALL_SORT_BND) {
+      SMALL_SORT(&dst[left], right - left + 1U);
       return;
     }
 
-    SORT_SWAP(dst[start], dst[end]);
-    start++;
-    end--;
+    if (++loop_count >= max_loops) {
+      /* too many bad pivots; just sort what's left */
+      HEAP_SORT(&dst[left], right - left + 1U);
+      return;
+    }
+
+    middle = left + ((right - left) >> 1);
+    pivot = MEDIAN((const SORT_TYPE *) dst, left, middle, right);
+    new_pivot = QUICK_SORT_PARTITION(dst, left, right, pivot);
+
+    if ((new_pivot == SIZE_MAX) || (new_pivot == nth)) {
+      return;
+    }
+
+    if (nth < new_pivot) {
+      right = new_pivot - 1U;
+    } else {
+      left = new_pivot + 1U;
+    }
   }
 }
 
-static size_t COUNT_RUN(SORT_TYPE *dst, const size_t start, const size_t size) {
-  size_t curr;
+/* The k largest of src[0, size) into out[0, k), in no particular order, using
+   buffer (room for 2k elements).  Returns how many were found, MIN(k, size). */
+static size_t TOP_K_UNSORTED(SORT_TYPE *src, const size_t size, const size_t k,
+                             SORT_TYPE *out, SORT_TYPE *buffer) {
+  size_t count, i;
 
-  if (size - start == 1) {
-    return 1;
+  if (size <= k) {
+    SORT_TYPE_CPY(out, src, size);
+    return size;
   }
 
-  if (start >= size - 2) {
-    if (SORT_CMP(dst[size - 2], dst[size - 1]) > 0) {
-      SORT_SWAP(dst[size - 2], dst[size - 1]);
+  count = MIN(size, 2 * k);
+  SORT_TYPE_CPY(buffer, src, count);
+
+  for (i = count; i < size; i++) {
+    if (count == 2 * k) {
+      TOP_K_SELECT(buffer, count, k);
+      SORT_TYPE_CPY(buffer, buffer + k, k);
+      count = k;
     }
 
-    return 2;
+    /* buffer[0] is the smallest of the best k found so far */
+    if (SORT_CMP(src[i], buffer[0]) > 0) {
+      buffer[count++] = src[i];
+    }
+  }
+
+  TOP_K_SELECT(buffer, count, count - k);
+  SORT_TYPE_CPY(out, buffer + (count - k), k);
+  return k;
+}
+
+SORT_DEF size_t TOP_K(SORT_TYPE *src, const size_t size, const size_t k, SORT_TYPE *out) {
+  SORT_TYPE *buffer;
+  size_t found;
+
+  if ((k == 0) || (size == 0)) {
+    return 0;
   }
 
-  curr = start + 2;
+  buffer = size > k ? SORT_NEW_BUFFER(2 * k) : NULL;
 
-  if (SORT_CMP(dst[start], dst[start + 1]) <= 0) {
-    /* increasing run */
-    while (1) {
-      if (curr == size - 1) {
-        break;
+  if ((size > k) && (buffer == NULL)) {
+    fprintf(stderr, "Error allocating temporary storage for top k: need %lu bytes",
+            (unsigned long)(sizeof(SORT_TYPE) * 2 * k));
+    exit(1);
+  }
+
+  found = TOP_K_UNSORTED(src, size, k, out, buffer);
+  QUICK_SORT(out, found);
+
+  if (buffer != NULL) {
+    SORT_DELETE_BUFFER(buffer);
+  }
+
+  return found;
+}
+
+
+/* nth element: rearrange dst so that dst[nth] is what it would be if dst were
+   sorted, with nothing bigger before it and nothing smaller after it.  Pivots come
+   from a Floyd-Rivest sample around nth, so usually only a couple of partitions
+   are needed; after too many bad ones it switches to median of medians pivots,
+   which guarantee linear time. */
+static void NTH_ELEMENT_RANGE(SORT_TYPE *dst, size_t left, size_t right, const size_t nth,
+                              int guaranteed);
+
+/* Median of medians: move the median of every group of 5 to the front, and pick the
+   median of those. */
+static size_t NTH_ELEMENT_PIVOT(SORT_TYPE *dst, const size_t left, const size_t right) {
+  const size_t groups = (right - left + 1U) / 5;
+  size_t i;
+
+  for (i = 0; i < groups; i++) {
+    SORT_TYPE *group = dst + left + 5 * i;
+    BITONIC_SORT_5(group);
+    SORT_SWAP(dst[left + i], group[2]);
+  }
+
+  NTH_ELEMENT_RANGE(dst, left, left + groups - 1U, left + groups / 2, 1);
+  return left + groups / 2;
+}
+
+static void NTH_ELEMENT_RANGE(SORT_TYPE *dst, size_t left, size_t right, const size_t nth,
+                              int guaranteed) {
+  size_t pivot, new_pivot, lo, hi, i;
+  int loop_count = 0;
+  const int max_loops = 64 - CLZ(right - left + 1U); /* ~lg N */
+
+  while (right - left + 1U > SMALL_SORT_BND) {
+    if (++loop_count >= max_loops) {
+      guaranteed = 1;
+    }
+
+    if (guaranteed) {
+      pivot = NTH_ELEMENT_PIVOT(dst, left, right);
+    } else if (right - left + 1U > SORT_SELECT_SAMPLE) {
+      sort_select_sample(right - left + 1U, nth - left, &lo, &hi);
+      NTH_ELEMENT_RANGE(dst, left + lo, left + hi, nth, 0);
+      pivot = nth;
+    } else {
+      pivot = MEDIAN((const SORT_TYPE *) dst, left, left + ((right - left) >> 1), right);
+    }
+
+    new_pivot = QUICK_SORT_PARTITION(dst, left, right, pivot);
+
+    /* check for partition all equal */
+    if ((new_pivot == SIZE_MAX) || (new_pivot == nth)) {
+      return;
+    }
+
+    if (nth < new_pivot) {
+      right = new_pivot - 1U;
+      continue;
+    }
+
+    left = new_pivot + 1U;
+
+    /* gather the copies of the pivot too, or lots of them could keep the right
+       side from shrinking */
+    if (guaranteed) {
+      for (i = left; i <= right; i++) {
+        if (SORT_CMP(dst[i], dst[new_pivot]) <= 0) {
+          SORT_SWAP(dst[i], dst[left]);
+          left++;
+        }
       }
 
-      if (SORT_CMP(dst[curr - 1], dst[curr]) > 0) {
-        break;
+      if (nth < left) {
+        return;
       }
+    }
+  }
+
+  if (right > left) {
+    SMALL_SORT(&dst[left], right - left + 1U);
+  }
+}
+
+SORT_DEF void NTH_ELEMENT(SORT_TYPE *dst, const size_t size, const size_t nth) {
+  if (nth < size) {
+    NTH_ELEMENT_RANGE(dst, 0, size - 1U, nth, 0);
+  }
+}
+
+/* k-way merge with a loser tree.  Input i is "less" than input j when its next
+   element is smaller, or equal and i < j, so equal elements come out in input
+   order; an exhausted input is bigger than everything. */
+static __inline int KWAY_MERGE_LESS(SORT_TYPE **inputs, const size_t *lens, const size_t *pos,
+                                    const size_t i, const size_t j) {
+  int cmp;
+
+  if (pos[i] == lens[i]) {
+    return 0;
+  }
+
+  if (pos[j] == lens[j]) {
+    return 1;
+  }
+
+  cmp = SORT_CMP(inputs[i][pos[i]], inputs[j][pos[j]]);
+  return (cmp < 0) || ((cmp == 0) && (i < j));
+}
+
+SORT_DEF void KWAY_MERGE(SORT_TYPE **inputs, const size_t *lens, const size_t k, SORT_TYPE *out) {
+  size_t *tree, *pos, *winners;
+  size_t total = 0;
+  size_t i, n;
+
+  if (k == 0) {
+    return;
+  }
+
+  if (k == 1) {
+    SORT_TYPE_CPY(out, inputs[0], lens[0]);
+    return;
+  }
+
+  /* tree[1, k) hold the losers of the internal nodes, whose children are 2n and
+     2n + 1, with input i as leaf k + i; tree[0] is the overall winner */
+  tree = (size_t *)malloc(4 * k * sizeof(size_t));
+
+  if (tree == NULL) {
+    fprintf(stderr, "Error allocating temporary storage for k-way merge: need %lu bytes",
+            (unsigned long)(4 * k * sizeof(size_t)));
+    exit(1);
+  }
 
-      curr++;
+  pos = tree + k;
+  winners = pos + k;
+
+  for (i = 0; i < k; i++) {
+    pos[i] = 0;
+    winners[k + i] = i;
+    total += lens[i];
+  }
+
+  for (n = k - 1; n > 0; n--) {
+    const size_t a = winners[2 * n];
+    const size_t b = winners[2 * n + 1];
+
+    if (KWAY_MERGE_LESS(inputs, lens, pos, b, a)) {
+      winners[n] = b;
+      tree[n] = a;
+    } else {
+      winners[n] = a;
+      tree[n] = b;
     }
+  }
 
-    return curr - start;
-  } else {
-    /* decreasing run */
-    while (1) {
-      if (curr == size - 1) {
-        break;
+  tree[0] = winners[1];
+
+  for (i = 0; i < total; i++) {
+    size_t winner = tree[0];
+    out[i] = inputs[winner][pos[winner]++];
+
+    /* replay the winner's path up to the root */
+    for (n = (k + winner) >> 1; n > 0; n >>= 1) {
+      if (KWAY_MERGE_LESS(inputs, lens, pos, tree[n], winner)) {
+        const size_t loser = winner;
+        winner = tree[n];
+        tree[n] = loser;
       }
+    }
 
-      if (SORT_CMP(dst[curr - 1], dst[curr]) <= 0) {
-        break;
+    tree[0] = winner;
+  }
+
+  free(tree);
+}
+
+
+/* Segmented sort: segment i is data[offsets[i]] to data[offsets[i + 1] - 1].
+   Tiny segments are gathered by size a batch at a time, so that every size runs
+   its sorting network over all of its segments back to back, instead of going
+   through a switch and a mispredicted branch per segment.  Bigger segments are
+   quick sorted, or for a stable sort merge sorted into buffer, which needs room
+   for the biggest of them. */
+#define SEGMENTED_SORT_NETWORK(n) \
+  case n: \
+    for (j = begin; j < end; j++) { \
+      BITONIC_SORT_ ## n(data + order[j]); \
+    } \
+    break;
+
+static void SEGMENTED_SORT_RANGE(SORT_TYPE *data, const size_t *offsets, const size_t first,
+                                 const size_t last, const int stable, SORT_TYPE *buffer) {
+  /* offsets of the batch's tiny segments, by size */
+  size_t order[SORT_SEGMENT_BATCH];
+  /* bucket n ends at starts[n] (after the fill below), and starts at starts[n - 1] */
+  size_t starts[SORT_SEGMENT_TINY + 2];
+  size_t batch, i, j, n;
+
+  for (batch = first; batch < last; batch += SORT_SEGMENT_BATCH) {
+    const size_t stop = MIN(batch + SORT_SEGMENT_BATCH, last);
+    memset(starts, 0, sizeof(starts));
+
+    for (i = batch; i < stop; i++) {
+      n = offsets[i + 1] - offsets[i];
+
+      if (n > SORT_SEGMENT_TINY) {
+        if (stable) {
+          MERGE_SORT_RECURSIVE(buffer, data + offsets[i], n);
+        } else {
+          QUICK_SORT(data + offsets[i], n);
+        }
+      } else if (n > 1) {
+        starts[n + 1]++;
       }
+    }
+
+    for (n = 1; n < SORT_SEGMENT_TINY + 2; n++) {
+      starts[n] += starts[n - 1];
+    }
+
+    for (i = batch; i < stop; i++) {
+      n = offsets[i + 1] - offsets[i];
 
-      curr++;
+      if ((n > 1) && (n <= SORT_SEGMENT_TINY)) {
+        order[starts[n]++] = offsets[i];
+      }
     }
 
-    /* reverse in-place */
-    REVERSE_ELEMENTS(dst, start, curr - 1);
-    return curr - start;
+    for (n = 2; n <= SORT_SEGMENT_TINY; n++) {
+      const size_t begin = starts[n - 1];
+      const size_t end = starts[n];
+
+      if (stable) {
+        for (j = begin; j < end; j++) {
+          SMALL_STABLE_SORT(data + order[j], n);
+        }
+
+        continue;
+      }
+
+      switch (n) {
+        SEGMENTED_SORT_NETWORK(2)
+        SEGMENTED_SORT_NETWORK(3)
+        SEGMENTED_SORT_NETWORK(4)
+        SEGMENTED_SORT_NETWORK(5)
+        SEGMENTED_SORT_NETWORK(6)
+        SEGMENTED_SORT_NETWORK(7)
+        SEGMENTED_SORT_NETWORK(8)
+        SEGMENTED_SORT_NETWORK(9)
+        SEGMENTED_SORT_NETWORK(10)
+        SEGMENTED_SORT_NETWORK(11)
+        SEGMENTED_SORT_NETWORK(12)
+        SEGMENTED_SORT_NETWORK(13)
+        SEGMENTED_SORT_NETWORK(14)
+        SEGMENTED_SORT_NETWORK(15)
+        SEGMENTED_SORT_NETWORK(16)
+      }
+    }
   }
 }
 
-static int CHECK_INVARIANT(TIM_SORT_RUN_T *stack, const int stack_curr) {
-  size_t A, B, C;
+#undef SEGMENTED_SORT_NETWORK
 
-  if (stack_curr < 2) {
-    return 1;
+/* Scratch space for a stable sort of segments first to last - 1, or NULL if none
+   of them needs any. */
+static SORT_TYPE *SEGMENTED_SORT_NEW_BUFFER(const size_t *offsets, const size_t first,
+    const size_t last) {
+  SORT_TYPE *buffer;
+  size_t i;
+  size_t biggest = 0;
+
+  for (i = first; i < last; i++) {
+    biggest = MAX(biggest, offsets[i + 1] - offsets[i]);
   }
 
-  if (stack_curr == 2) {
-    const size_t A1 = stack[stack_curr - 2].length;
-    const size_t B1 = stack[stack_curr - 1].length;
+  if (biggest <= SORT_SEGMENT_TINY) {
+    return NULL;
+  }
+
+  buffer = SORT_NEW_BUFFER(biggest);
+
+  if (buffer == NULL) {
+    fprintf(stderr, "Error allocating temporary storage for segmented sort: need %lu bytes",
+            (unsigned long)(sizeof(SORT_TYPE) * biggest));
+    exit(1);
+  }
+
+  return buffer;
+}
+
+SORT_DEF void SEGMENTED_SORT(SORT_TYPE *data, const size_t *offsets, const size_t nsegments) {
+  SEGMENTED_SORT_RANGE(data, offsets, 0, nsegments, 0, NULL);
+}
+
+SORT_DEF void STABLE_SEGMENTED_SORT(SORT_TYPE *data, const size_t *offsets,
+                                    const size_t nsegments) {
+  SORT_TYPE *buffer = SEGMENTED_SORT_NEW_BUFFER(offsets, 0, nsegments);
+  SEGMENTED_SORT_RANGE(data, offsets, 0, nsegments, 1, buffer);
+
+  if (buffer != NULL) {
+    SORT_DELETE_BUFFER(buffer);
+  }
+}
+
+/* Sort, then drop duplicates or find the groups of equal elements.  Rather than
+   walking the sorted array again, this is done by the last merge of a merge sort:
+   as it takes each element it already knows the one before. */
+
+/* Merge a and b into out (which overlaps neither), taking equal elements from a
+   first.  prev is the element that comes before them all, or NULL.  If unique, only
+   the first element of each group of equal ones is written, and this returns how
+   many were; otherwise everything is written and this returns how many groups
+   start here, putting the index of each one's first element plus base into starts
+   if that isn't NULL. */
+static size_t SORT_UNIQUE_MERGE(SORT_TYPE *a, const size_t na, SORT_TYPE *b, const size_t nb,
+                                SORT_TYPE *out, SORT_TYPE *prev, const int unique,
+                                size_t *starts, const size_t base) {
+  size_t i = 0;
+  size_t j = 0;
+  size_t k = 0;
+  size_t found = 0;
+
+  while ((i < na) || (j < nb)) {
+    SORT_TYPE *next;
+
+    if ((j == nb) || ((i < na) && (SORT_CMP(a[i], b[j]) <= 0))) {
+      next = &a[i++];
+    } else {
+      next = &b[j++];
+    }
+
+    if ((prev == NULL) || (SORT_CMP(*prev, *next) != 0)) {
+      if (unique) {
+        out[found] = *next;
+      } else if (starts != NULL) {
+        starts[found] = base + k;
+      }
+
+      found++;
+    }
+
+    if (!unique) {
+      out[k++] = *next;
+    }
+
+    prev = next;
+  }
+
+  return found;
+}
+
+static size_t SORT_UNIQUE_RUN(SORT_TYPE *dst, const size_t size, const int unique,
+                              size_t *starts) {
+  const size_t middle = size / 2;
+  SORT_TYPE *newdst;
+  size_t found;
+
+  if (size <= 1) {
+    if ((size == 1) && (starts != NULL)) {
+      starts[0] = 0;
+    }
+
+    return size;
+  }
+
+  newdst = SORT_NEW_BUFFER(size);
+
+  if (newdst == NULL) {
+    fprintf(stderr, "Error allocating temporary storage for sorted unique: need %lu bytes",
+            (unsigned long)(sizeof(SORT_TYPE) * size));
+    exit(1);
+  }
+
+  MERGE_SORT_RECURSIVE(newdst, dst, middle);
+  MERGE_SORT_RECURSIVE(newdst, dst + middle, size - middle);
+  found = SORT_UNIQUE_MERGE(dst, middle, dst + middle, size - middle, newdst, NULL, unique,
+                            starts, 0);
+  SORT_TYPE_CPY(dst, newdst, unique ? found : size);
+  SORT_DELETE_BUFFER(newdst);
+  return found;
+}
+
+/* Sort dst and drop all but the first (in the original order) of every group of
+   equal elements, returning how many are left. */
+SORT_DEF size_t SORT_UNIQUE(SORT_TYPE *dst, const size_t size) {
+  return SORT_UNIQUE_RUN(dst, size, 1, NULL);
+}
+
+/* Stably sort dst and put the index of the first element of every group of equal
+   elements into starts (which needs room for size of them), returning how many
+   groups there are. */
+SORT_DEF size_t SORT_GROUPS(SORT_TYPE *dst, const size_t size, size_t *starts) {
+  return SORT_UNIQUE_RUN(dst, size, 0, starts);
+}
+
+/* timsort implementation, based on timsort.txt */
+
+static size_t COUNT_RUN(SORT_TYPE *dst, const size_t start, const size_t size) {
+  size_t curr;
+
+  if (size - start == 1) {
+    return 1;
+  }
+
+  if (start >= size - 2) {
+    if (SORT_CMP(dst[size - 2], dst[size - 1]) > 0) {
+      SORT_SWAP(dst[size - 2], dst[size - 1]);
+    }
+
+    return 2;
+  }
+
+  if (SORT_CMP(dst[start], dst[start + 1]) <= 0) {
+    /* increasing run */
+    return SORTED_UNTIL(&dst[start], size - start, 0);
+  }
+
+  /* decreasing run, reversed in-place */
+  curr = SORTED_UNTIL(&dst[start], size - start, 1);
+  REVERSE_ELEMENTS(dst, start, start + curr - 1);
+  return curr;
+}
+
+static int CHECK_INVARIANT(TIM_SORT_RUN_T *stack, const int stack_curr) {
+  size_t A, B, C;
+
+  if (stack_curr < 2) {
+    return 1;
+  }
+
+  if (stack_curr == 2) {
+    const size_t A1 = stack[stack_curr - 2].length;
+    const size_t B1 = stack[stack_curr - 1].length;
+
+    if (A1 <= B1) {
+      return 0;
+    }
+
+    return 1;
+  }
+
+  A = stack[stack_curr - 3].length;
+  B = stack[stack_curr - 2].length;
+  C = stack[stack_curr - 1].length;
+
+  if ((A <= B + C) || (B <= C)) {
+    return 0;
+  }
+
+  return 1;
+}
+
+typedef struct {
+  size_t alloc;
+  SORT_TYPE *storage;
+} TEMP_STORAGE_T;
+
+static void TIM_SORT_RESIZE(TEMP_STORAGE_T *store, const size_t new_size) {
+  if ((store->storage == NULL) || (store->alloc < new_size)) {
+    SORT_TYPE *tempstore = (SORT_TYPE *)realloc(store->storage, new_size * sizeof(SORT_TYPE));
+
+    if (tempstore == NULL) {
+      fprintf(stderr, "Error allocating temporary storage for tim sort: need %lu bytes",
+              (unsigned long)(sizeof(SORT_TYPE) * new_size));
+      exit(1);
+    }
+
+    store->storage = tempstore;
+    store->alloc = new_size;
+  }
+}
+
+static void TIM_SORT_MERGE(SORT_TYPE *dst, const TIM_SORT_RUN_T *stack, const int stack_curr,
+                           TEMP_STORAGE_T *store) {
+  const size_t A = stack[stack_curr - 2].length;
+  const size_t B = stack[stack_curr - 1].length;
+  const size_t curr = stack[stack_curr - 2].start;
+  SORT_TYPE *storage;
+  size_t i, j, k;
+#ifdef SORT_PRIMITIVE
+  size_t n;
+#endif
+  TIM_SORT_RESIZE(store, MIN(A, B));
+  storage = store->storage;
+
+  /* left merge */
+  if (A < B) {
+    SORT_TYPE_CPY(storage, &dst[curr], A);
+    i = 0;
+    j = curr + A;
+    k = curr;
+#ifdef SORT_PRIMITIVE
+    k += sort_simd_merge(SORT_SIMD_KIND, 0, &dst[curr], storage, A, &dst[curr + A], B, &i);
+    j = k + A - i;
+#endif
+
+    while ((i < A) && (j < curr + A + B)) {
+      if (SORT_CMP(storage[i], dst[j]) <= 0) {
+        dst[k++] = storage[i++];
+      } else {
+        dst[k++] = dst[j++];
+      }
+    }
+
+    /* the rest of B is already in place */
+    SORT_TYPE_CPY(&dst[k], &storage[i], A - i);
+  } else {
+    /* right merge */
+    SORT_TYPE_CPY(storage, &dst[curr + A], B);
+    i = B;
+    j = curr + A;
+    k = curr + A + B;
+#ifdef SORT_PRIMITIVE
+    k -= sort_simd_merge(SORT_SIMD_KIND, 1, &dst[curr], &dst[curr], A, storage, B, &n);
+    j -= n;
+    i = k - j;
+#endif
+
+    while ((i > 0) && (j > curr)) {
+      if (SORT_CMP(dst[j - 1], storage[i - 1]) > 0) {
+        dst[--k] = dst[--j];
+      } else {
+        dst[--k] = storage[--i];
+      }
+    }
+
+    /* the rest of A is already in place */
+    SORT_TYPE_CPY(&dst[k - i], storage, i);
+  }
+}
+
+static int TIM_SORT_COLLAPSE(SORT_TYPE *dst, TIM_SORT_RUN_T *stack, int stack_curr,
+                             TEMP_STORAGE_T *store, const size_t size) {
+  while (1) {
+    size_t A, B, C, D;
+    int ABC, BCD, CD;
+
+    /* if the stack only has one thing on it, we are done with the collapse */
+    if (stack_curr <= 1) {
+      break;
+    }
+
+    /* if this is the last merge, just do it */
+    if ((stack_curr == 2) && (stack[0].length + stack[1].length == size)) {
+      TIM_SORT_MERGE(dst, stack, stack_curr, store);
+      stack[0].length += stack[1].length;
+      stack_curr--;
+      break;
+    }
+    /* check if the invariant is off for a stack of 2 elements */
+    else if ((stack_curr == 2) && (stack[0].length <= stack[1].length)) {
+      TIM_SORT_MERGE(dst, stack, stack_curr, store);
+      stack[0].length += stack[1].length;
+      stack_curr--;
+      break;
+    } else if (stack_curr == 2) {
+      break;
+    }
+
+    B = stack[stack_curr - 3].length;
+    C = stack[stack_curr - 2].length;
+    D = stack[stack_curr - 1].length;
+
+    if (stack_curr >= 4) {
+      A = stack[stack_curr - 4].length;
+      ABC = (A <= B + C);
+    } else {
+      ABC = 0;
+    }
+
+    BCD = (B <= C + D) || ABC;
+    CD = (C <= D);
+
+    /* Both invariants are good */
+    if (!BCD && !CD) {
+      break;
+    }
+
+    /* left merge */
+    if (BCD && !CD) {
+      TIM_SORT_MERGE(dst, stack, stack_curr - 1, store);
+      stack[stack_curr - 3].length += stack[stack_curr - 2].length;
+      stack[stack_curr - 2] = stack[stack_curr - 1];
+      stack_curr--;
+    } else {
+      /* right merge */
+      TIM_SORT_MERGE(dst, stack, stack_curr, store);
+      stack[stack_curr - 2].length += stack[stack_curr - 1].length;
+      stack_curr--;
+    }
+  }
+
+  return stack_curr;
+}
+
+static __inline int PUSH_NEXT(SORT_TYPE *dst,
+                              const size_t size,
+                              TEMP_STORAGE_T *store,
+                              const size_t minrun,
+                              TIM_SORT_RUN_T *run_stack,
+                              size_t *stack_curr,
+                              size_t *curr) {
+  size_t len = COUNT_RUN(dst, *curr, size);
+  size_t run = minrun;
+
+  if (run > size - *curr) {
+    run = size - *curr;
+  }
+
+  if (run > len) {
+    BINARY_INSERTION_SORT_START(&dst[*curr], len, run);
+    len = run;
+  }
+
+  run_stack[*stack_curr].start = *curr;
+  run_stack[*stack_curr].length = len;
+  (*stack_curr)++;
+  *curr += len;
+
+  if (*curr == size) {
+    /* finish up */
+    while (*stack_curr > 1) {
+      TIM_SORT_MERGE(dst, run_stack, (int)*stack_curr, store);
+      run_stack[*stack_curr - 2].length += run_stack[*stack_curr - 1].length;
+      (*stack_curr)--;
+    }
+
+    if (store->storage != NULL) {
+      free(store->storage);
+      store->storage = NULL;
+    }
+
+    return 0;
+  }
+
+  return 1;
+}
+
+SORT_DEF void TIM_SORT(SORT_TYPE *dst, const size_t size) {
+  size_t minrun;
+  TEMP_STORAGE_T _store, *store;
+  TIM_SORT_RUN_T run_stack[TIM_SORT_STACK_SIZE];
+  size_t stack_curr = 0;
+  size_t curr = 0;
+
+  /* don't bother sorting an array of size 1 */
+  if (size <= 1) {
+    return;
+  }
+
+  if (size < 64) {
+    SMALL_STABLE_SORT(dst, size);
+    return;
+  }
+
+  /* compute the minimum run length */
+  minrun = compute_minrun(size);
+  /* temporary storage for merges */
+  store = &_store;
+  store->alloc = 0;
+  store->storage = NULL;
+
+  if (!PUSH_NEXT(dst, size, store, minrun, run_stack, &stack_curr, &curr)) {
+    return;
+  }
+
+  if (!PUSH_NEXT(dst, size, store, minrun, run_stack, &stack_curr, &curr)) {
+    return;
+  }
+
+  if (!PUSH_NEXT(dst, size, store, minrun, run_stack, &stack_curr, &curr)) {
+    return;
+  }
+
+  while (1) {
+    if (!CHECK_INVARIANT(run_stack, (int)stack_curr)) {
+      stack_curr = TIM_SORT_COLLAPSE(dst, run_stack, (int)stack_curr, store, size);
+      continue;
+    }
+
+    if (!PUSH_NEXT(dst, size, store, minrun, run_stack, &stack_curr, &curr)) {
+      return;
+    }
+  }
+}
+
+/* heap sort: based on wikipedia */
+
+static __inline void HEAP_SIFT_DOWN(SORT_TYPE *dst, const size_t start, const size_t end) {
+  size_t root = start;
+
+  while ((root << 1) <= end) {
+    size_t child = root << 1;
+
+    if ((child < end) && (SORT_CMP(dst[child], dst[child + 1]) < 0)) {
+      child++;
+    }
+
+    if (SORT_CMP(dst[root], dst[child]) < 0) {
+      SORT_SWAP(dst[root], dst[child]);
+      root = child;
+    } else {
+      return;
+    }
+  }
+}
+
+static __inline void HEAPIFY(SORT_TYPE *dst, const size_t size) {
+  size_t start = size >> 1;
+
+  while (1) {
+    HEAP_SIFT_DOWN(dst, start, size - 1);
+
+    if (start == 0) {
+      break;
+    }
+
+    start--;
+  }
+}
+
+SORT_DEF void HEAP_SORT(SORT_TYPE *dst, const size_t size) {
+  size_t end = size - 1;
+
+  /* don't bother sorting an array of size <= 1, or one that is in order already */
+  if ((size <= 1) || PRESORTED(dst, size)) {
+    return;
+  }
+
+  HEAPIFY(dst, size);
+
+  while (end > 0) {
+    SORT_SWAP(dst[end], dst[0]);
+    HEAP_SIFT_DOWN(dst, 0, end - 1);
+    end--;
+  }
+}
+
+/* sample sort: an in-place super scalar sample sort, after IPS4o (Axtmann, Witt,
+   Ferizovic and Sanders, "In-place Parallel Super Scalar Samplesort", 2017).
+
+   Each level splits the range into up to SAMPLE_SORT_MAX_BUCKETS buckets at once,
+   so random data needs about log256(n) passes over memory rather than log2(n).
+   Elements find their bucket by walking an implicit search tree of splitters
+   without branching, are gathered in one block-sized buffer per bucket, and are
+   written back a full block at a time over the part of the array already read.
+   The blocks are then permuted into place, so the extra memory is a fixed number
+   of blocks per bucket no matter how large the array is. */
+
+typedef struct {
+  SORT_TYPE *tree;      /* splitters as an implicit search tree, root at 1 */
+  SORT_TYPE *splitters; /* sorted, padded with copies of the largest */
+  size_t nbuckets;
+  int log_buckets;
+  int equal_buckets;    /* every splitter also gets a bucket for its duplicates */
+} SAMPLE_SORT_CLASSIFIER_T;
+
+typedef struct {
+  SORT_TYPE *buffers;   /* one block per bucket */
+  SORT_TYPE *swap;      /* two blocks */
+  size_t fill[SAMPLE_SORT_MAX_BUCKETS];
+} SAMPLE_SORT_BUFFERS_T;
+
+typedef struct {
+  SAMPLE_SORT_CLASSIFIER_T classifier;
+  SAMPLE_SORT_BUFFERS_T buffers;
+  SORT_TYPE *overflow;  /* one block, for a block that would run off the end */
+  SORT_TYPE *memory;
+  uint64_t rng;
+} SAMPLE_SORT_T;
+
+static void SAMPLE_SORT_BUILD_TREE(SAMPLE_SORT_CLASSIFIER_T *c, const size_t node,
+                                   const size_t lo, const size_t hi) {
+  const size_t middle = lo + ((hi - lo) >> 1);
+
+  if (lo >= hi) {
+    return;
+  }
+
+  c->tree[node] = c->splitters[middle];
+  SAMPLE_SORT_BUILD_TREE(c, 2 * node, lo, middle);
+  SAMPLE_SORT_BUILD_TREE(c, 2 * node + 1, middle + 1, hi);
+}
+
+/* Choose splitters from a sorted random sample of dst, which is left at the front
+   of dst.  Too many repeated splitters means lots of duplicate keys: those get
+   buckets of their own, which need no further sorting. */
+static void SAMPLE_SORT_BUILD(SAMPLE_SORT_CLASSIFIER_T *c, SORT_TYPE *dst, const size_t size,
+                              uint64_t *rng) {
+  const size_t oversampling = MAX(1, (64 - CLZ(size)) / 5);
+  size_t buckets = 2;
+  size_t samples, unique, i;
+  int log_buckets = 1;
+
+  /* aim for at least a few blocks per bucket */
+  while ((2 * buckets <= SAMPLE_SORT_MAX_BUCKETS) &&
+         (size / (8 * buckets) >= SAMPLE_SORT_BLOCK)) {
+    buckets *= 2;
+    log_buckets++;
+  }
+
+  samples = oversampling * buckets - 1;
+
+  for (i = 0; i < samples; i++) {
+    size_t j;
+    *rng ^= *rng << 13;
+    *rng ^= *rng >> 7;
+    *rng ^= *rng << 17;
+    j = i + (size_t)(*rng % (uint64_t)(size - i));
+    SORT_SWAP(dst[i], dst[j]);
+  }
+
+  QUICK_SORT(dst, samples);
+  unique = 0;
+
+  for (i = 1; i < buckets; i++) {
+    SORT_TYPE splitter = dst[i * oversampling - 1];
+
+    if ((unique == 0) || (SORT_CMP(c->splitters[unique - 1], splitter) < 0)) {
+      c->splitters[unique++] = splitter;
+    }
+  }
+
+  c->equal_buckets = unique < buckets - 1;
+
+  if (c->equal_buckets) {
+    buckets = 2;
+    log_buckets = 1;
+
+    while (buckets <= unique) {
+      buckets *= 2;
+      log_buckets++;
+    }
+
+    if (2 * buckets > SAMPLE_SORT_MAX_BUCKETS) {
+      /* keep every other splitter so the equal buckets fit */
+      for (i = 0; 2 * i + 1 < unique; i++) {
+        c->splitters[i] = c->splitters[2 * i + 1];
+      }
+
+      unique = i;
+      buckets /= 2;
+      log_buckets--;
+    }
+  }
+
+  for (i = unique; i < buckets; i++) {
+    c->splitters[i] = c->splitters[unique - 1];
+  }
+
+  c->log_buckets = log_buckets;
+  c->nbuckets = c->equal_buckets ? 2 * buckets : buckets;
+  SAMPLE_SORT_BUILD_TREE(c, 1, 0, buckets - 1);
+}
+
+/* Bucket of x: one comparison per level of the tree, and no branches. */
+static __inline size_t SAMPLE_SORT_CLASSIFY(const SAMPLE_SORT_CLASSIFIER_T *c, SORT_TYPE x) {
+  const size_t leaves = (size_t)1 << c->log_buckets;
+  size_t i = 1;
+  int level;
+
+  for (level = 0; level < c->log_buckets; level++) {
+    i = 2 * i + (SORT_CMP(c->tree[i], x) < 0);
+  }
+
+  i -= leaves;
+
+  if (c->equal_buckets) {
+    i = 2 * i + ((i + 1 < leaves) & (SORT_CMP(x, c->splitters[i]) >= 0));
+  }
+
+  return i;
+}
+
+/* Put x in the buffer of bucket t, first writing the buffer out to dst[*write]
+   when it is full. */
+static __inline void SAMPLE_SORT_PUSH(SAMPLE_SORT_BUFFERS_T *b, SORT_TYPE *dst, size_t *write,
+                                      size_t *counts, const size_t t, SORT_TYPE x) {
+  const size_t block = SAMPLE_SORT_BLOCK;
+
+  if (b->fill[t] == block) {
+    SORT_TYPE_CPY(dst + *write, b->buffers + t * block, block);
+    *write += block;
+    counts[t] += block;
+    b->fill[t] = 0;
+  }
+
+  b->buffers[t * block + b->fill[t]++] = x;
+}
+
+/* Classify dst[begin, end), leaving full blocks (each of a single bucket) in
+   dst[begin, returned value) and the rest in the buffers.  counts gets the size of
+   every bucket.  Four elements go down the tree side by side to keep the pipeline
+   busy. */
+static size_t SAMPLE_SORT_LOCAL(const SAMPLE_SORT_CLASSIFIER_T *c, SAMPLE_SORT_BUFFERS_T *b,
+                                SORT_TYPE *dst, const size_t begin, const size_t end,
+                                size_t *counts) {
+  const size_t leaves = (size_t)1 << c->log_buckets;
+  size_t write = begin;
+  size_t i, t;
+
+  for (t = 0; t < c->nbuckets; t++) {
+    b->fill[t] = 0;
+    counts[t] = 0;
+  }
+
+  for (i = begin; i + 4 <= end; i += 4) {
+    size_t t0 = 1, t1 = 1, t2 = 1, t3 = 1;
+    int level;
+
+    for (level = 0; level < c->log_buckets; level++) {
+      t0 = 2 * t0 + (SORT_CMP(c->tree[t0], dst[i]) < 0);
+      t1 = 2 * t1 + (SORT_CMP(c->tree[t1], dst[i + 1]) < 0);
+      t2 = 2 * t2 + (SORT_CMP(c->tree[t2], dst[i + 2]) < 0);
+      t3 = 2 * t3 + (SORT_CMP(c->tree[t3], dst[i + 3]) < 0);
+    }
+
+    t0 -= leaves;
+    t1 -= leaves;
+    t2 -= leaves;
+    t3 -= leaves;
+
+    if (c->equal_buckets) {
+      t0 = 2 * t0 + ((t0 + 1 < leaves) & (SORT_CMP(dst[i], c->splitters[t0]) >= 0));
+      t1 = 2 * t1 + ((t1 + 1 < leaves) & (SORT_CMP(dst[i + 1], c->splitters[t1]) >= 0));
+      t2 = 2 * t2 + ((t2 + 1 < leaves) & (SORT_CMP(dst[i + 2], c->splitters[t2]) >= 0));
+      t3 = 2 * t3 + ((t3 + 1 < leaves) & (SORT_CMP(dst[i + 3], c->splitters[t3]) >= 0));
+    }
+
+    /* a flush only ever writes below the element being pushed */
+    SAMPLE_SORT_PUSH(b, dst, &write, counts, t0, dst[i]);
+    SAMPLE_SORT_PUSH(b, dst, &write, counts, t1, dst[i + 1]);
+    SAMPLE_SORT_PUSH(b, dst, &write, counts, t2, dst[i + 2]);
+    SAMPLE_SORT_PUSH(b, dst, &write, counts, t3, dst[i + 3]);
+  }
+
+  for (; i < end; i++) {
+    SAMPLE_SORT_PUSH(b, dst, &write, counts, SAMPLE_SORT_CLASSIFY(c, dst[i]), dst[i]);
+  }
+
+  for (t = 0; t < c->nbuckets; t++) {
+    counts[t] += b->fill[t];
+  }
+
+  return write;
+}
+
+/* The blocks of bucket [lo, hi) were written to [ROUND(lo), written); copy the
+   part past hi, which sits in the next buckets, to out.  If the last block ran off
+   the end of dst it was kept in overflow instead, and its first part has already
+   been copied back to dst.  Returns how many elements were copied. */
+static size_t SAMPLE_SORT_SPILL(SORT_TYPE *dst, const size_t size, const size_t lo,
+                                const size_t hi, const size_t written, SORT_TYPE *overflow,
+                                SORT_TYPE *out) {
+  const size_t block = SAMPLE_SORT_BLOCK;
+  size_t in_dst;
+
+  if ((written <= hi) || (written == SAMPLE_SORT_ROUND(lo))) {
+    return 0;
+  }
+
+  in_dst = MIN(written, size) - hi;
+  SORT_TYPE_CPY(out, dst + hi, in_dst);
+
+  if (written > size) {
+    SORT_TYPE_CPY(out + in_dst, overflow + (size - (written - block)), written - size);
+  }
+
+  return written - hi;
+}
+
+/* Copy len elements from src into the holes of a bucket: first [*pos, head_end),
+   then on from tail. */
+static __inline void SAMPLE_SORT_PUT(SORT_TYPE *dst, size_t *pos, const size_t head_end,
+                                     const size_t tail, SORT_TYPE *src, size_t len) {
+  while (len > 0) {
+    size_t n = len;
+
+    if (*pos == head_end) {
+      *pos = tail;
+    }
+
+    if (*pos < head_end) {
+      n = MIN(len, head_end - *pos);
+    }
+
+    SORT_TYPE_CPY(dst + *pos, src, n);
+    *pos += n;
+    src += n;
+    len -= n;
+  }
+}
+
+/* Finish bucket number t, [lo, hi), whose blocks fill [ROUND(lo), written): the
+   gap before the first block and after the last one get the spill and whatever is
+   left in the bucket's buffer in each of bufs. */
+static void SAMPLE_SORT_CLEANUP(SORT_TYPE *dst, const size_t t, const size_t lo,
+                                const size_t hi, const size_t written, SORT_TYPE *spill,
+                                const size_t spill_len, SAMPLE_SORT_BUFFERS_T *bufs,
+                                const size_t nbufs) {
+  const size_t block = SAMPLE_SORT_BLOCK;
+  const size_t head_end = MIN(SAMPLE_SORT_ROUND(lo), hi);
+  size_t pos = lo;
+  size_t i;
+  SAMPLE_SORT_PUT(dst, &pos, head_end, written, spill, spill_len);
+
+  for (i = 0; i < nbufs; i++) {
+    SAMPLE_SORT_PUT(dst, &pos, head_end, written, bufs[i].buffers + t * block, bufs[i].fill[t]);
+  }
+}
+
+/* One level of sample sort: rearrange dst into the buckets of the classifier, and
+   store where they start in bounds[0..nbuckets]. */
+static void SAMPLE_SORT_PARTITION(SORT_TYPE *dst, const size_t size, SAMPLE_SORT_T *s,
+                                  size_t *bounds) {
+  const SAMPLE_SORT_CLASSIFIER_T *c = &s->classifier;
+  SAMPLE_SORT_BUFFERS_T *b = &s->buffers;
+  const size_t block = SAMPLE_SORT_BLOCK;
+  size_t write[SAMPLE_SORT_MAX_BUCKETS];
+  size_t read[SAMPLE_SORT_MAX_BUCKETS];
+  size_t spill_bucket = SIZE_MAX;
+  size_t full, i, t;
+  /* bounds doubles as the bucket sizes until the prefix sum */
+  full = SAMPLE_SORT_LOCAL(c, b, dst, 0, size, bounds + 1);
+  bounds[0] = 0;
+
+  for (t = 0; t < c->nbuckets; t++) {
+    bounds[t + 1] += bounds[t];
+    write[t] = SAMPLE_SORT_ROUND(bounds[t]);
+    read[t] = MAX(write[t], MIN(SAMPLE_SORT_ROUND(bounds[t + 1]), full));
+  }
+
+  /* Move every full block to its bucket: blocks in [write[t], read[t]) have not been
+     looked at yet, blocks below write[t] are done. */
+  for (i = 0; i < c->nbuckets; i++) {
+    while (read[i] > write[i]) {
+      SORT_TYPE *current = b->swap;
+      read[i] -= block;
+      SORT_TYPE_CPY(current, dst + read[i], block);
+
+      while (1) {
+        t = SAMPLE_SORT_CLASSIFY(c, current[0]);
+
+        if (write[t] < read[t]) {
+          /* swap with the unread block in the way and carry that one on */
+          SORT_TYPE *next = (current == b->swap) ? b->swap + block : b->swap;
+          SORT_TYPE_CPY(next, dst + write[t], block);
+          SORT_TYPE_CPY(dst + write[t], current, block);
+          write[t] += block;
+          current = next;
+        } else {
+          if (write[t] + block > size) {
+            SORT_TYPE_CPY(s->overflow, current, block);
+            spill_bucket = t;
+          } else {
+            SORT_TYPE_CPY(dst + write[t], current, block);
+          }
+
+          write[t] += block;
+          break;
+        }
+      }
+    }
+  }
+
+  if (spill_bucket != SIZE_MAX) {
+    const size_t start = write[spill_bucket] - block;
+    SORT_TYPE_CPY(dst + start, s->overflow, size - start);
+  }
+
+  /* fill in the partial blocks at the ends of every bucket, in order, so each spill
+     is picked up before the next bucket writes over it */
+  for (t = 0; t < c->nbuckets; t++) {
+    const size_t spill_len = SAMPLE_SORT_SPILL(dst, size, bounds[t], bounds[t + 1], write[t],
+                             s->overflow, b->swap);
+    SAMPLE_SORT_CLEANUP(dst, t, bounds[t], bounds[t + 1], write[t], b->swap, spill_len, b, 1);
+  }
+}
+
+static void SAMPLE_SORT_RECURSIVE(SORT_TYPE *dst, const size_t size, SAMPLE_SORT_T *s,
+                                  int budget) {
+  size_t bounds[SAMPLE_SORT_MAX_BUCKETS + 1];
+  size_t nbuckets, t;
+  int equal_buckets;
+
+  if (size <= SAMPLE_SORT_BASE_CASE) {
+    QUICK_SORT(dst, size);
+    return;
+  }
+
+  if (--budget == 0) {
+    /* too many levels of bad splitters; switch to heap sort */
+    HEAP_SORT(dst, size);
+    return;
+  }
+
+  SAMPLE_SORT_BUILD(&s->classifier, dst, size, &s->rng);
+  SAMPLE_SORT_PARTITION(dst, size, s, bounds);
+  nbuckets = s->classifier.nbuckets;
+  equal_buckets = s->classifier.equal_buckets;
 
-    if (A1 <= B1) {
-      return 0;
+  for (t = 0; t < nbuckets; t++) {
+    const size_t n = bounds[t + 1] - bounds[t];
+
+    /* equal buckets hold copies of a single key */
+    if (equal_buckets && (t & 1)) {
+      continue;
     }
 
-    return 1;
+    if (n <= SMALL_SORT_BND) {
+      SMALL_SORT(dst + bounds[t], n);
+    } else {
+      SAMPLE_SORT_RECURSIVE(dst + bounds[t], n, s, budget);
+    }
   }
+}
 
-  A = stack[stack_curr - 3].length;
-  B = stack[stack_curr - 2].length;
-  C = stack[stack_curr - 1].length;
+/* Set up the scratch space of a sample sort; returns 0 if it can't be allocated. */
+static int SAMPLE_SORT_INIT(SAMPLE_SORT_T *s, const size_t size) {
+  const size_t block = SAMPLE_SORT_BLOCK;
+  s->memory = SORT_NEW_BUFFER(2 * SAMPLE_SORT_MAX_BUCKETS + (SAMPLE_SORT_MAX_BUCKETS + 3) * block);
 
-  if ((A <= B + C) || (B <= C)) {
+  if (s->memory == NULL) {
     return 0;
   }
 
+  s->classifier.tree = s->memory;
+  s->classifier.splitters = s->memory + SAMPLE_SORT_MAX_BUCKETS;
+  s->buffers.buffers = s->memory + 2 * SAMPLE_SORT_MAX_BUCKETS;
+  s->buffers.swap = s->buffers.buffers + SAMPLE_SORT_MAX_BUCKETS * block;
+  s->overflow = s->buffers.swap + 2 * block;
+  s->rng = 0x9E3779B97F4A7C15ULL ^ (uint64_t)size;
   return 1;
 }
 
-typedef struct {
-  size_t alloc;
-  SORT_TYPE *storage;
-} TEMP_STORAGE_T;
+SORT_DEF void SAMPLE_SORT(SORT_TYPE *dst, const size_t size) {
+  SAMPLE_SORT_T s;
 
-static void TIM_SORT_RESIZE(TEMP_STORAGE_T *store, const size_t new_size) {
-  if ((store->storage == NULL) || (store->alloc < new_size)) {
-    SORT_TYPE *tempstore = (SORT_TYPE *)realloc(store->storage, new_size * sizeof(SORT_TYPE));
+  /* not worth the setup for small arrays, or when we can't get the memory */
+  if ((size <= SAMPLE_SORT_BASE_CASE) || !SAMPLE_SORT_INIT(&s, size)) {
+    QUICK_SORT(dst, size);
+    return;
+  }
 
-    if (tempstore == NULL) {
-      fprintf(stderr, "Error allocating temporary storage for tim sort: need %lu bytes",
-              (unsigned long)(sizeof(SORT_TYPE) * new_size));
-      exit(1);
-    }
+  SAMPLE_SORT_RECURSIVE(dst, size, &s, 64 - CLZ(size)); /* ~lg N */
+  SORT_DELETE_BUFFER(s.memory);
+}
 
-    store->storage = tempstore;
-    store->alloc = new_size;
+#ifdef SORT_PRIMITIVE
+
+/* radix sort: for when SORT_TYPE is a built-in integer type, float or double (and
+   SORT_PRIMITIVE is defined), an LSD radix sort a byte at a time, which never calls
+   SORT_CMP.  The histograms of all the bytes are counted in one pass up front, and a
+   byte that is the same in every key is skipped outright.  Elements are scattered
+   through a cache line sized buffer per bucket, so each pass writes whole lines at a
+   time. */
+
+static __inline uint64_t RADIX_SORT_KEY(SORT_TYPE x) {
+  const uint64_t sign = (uint64_t)1 << (8 * sizeof(SORT_TYPE) - 1);
+  const uint64_t ones = sign | (sign - 1);
+  const uint64_t nans = (sizeof(SORT_TYPE) == 4) ? ((uint64_t)1 << 23) - 1 :
+                        ((uint64_t)1 << 52) - 1;
+  union {
+    SORT_TYPE x;
+    uint32_t u32;
+    uint64_t u64;
+  } bits;
+  uint64_t key;
+
+  /* flipping the sign bit puts the negative numbers first */
+  if (!SORT_RADIX_FLOAT) {
+    key = (uint64_t)x;
+    return SORT_RADIX_SIGNED ? key ^ sign : key;
   }
+
+  /* IEEE-754 total order: flipping every bit of the negative numbers as well puts
+     the bigger ones first, and -0.0 just before 0.0.  That leaves the NaNs with the
+     sign bit set below -inf and the others above inf, as many of each as there are
+     NaN mantissas; turning the keys around by that many takes one lot round to the
+     other end, so NaNs go last, or first with SORT_NAN_FIRST. */
+  bits.x = x;
+  key = (sizeof(SORT_TYPE) == 4) ? bits.u32 : bits.u64;
+  key ^= ((0 - (key >> (8 * sizeof(SORT_TYPE) - 1))) & ones) | sign;
+#ifdef SORT_NAN_FIRST
+  return (key + nans) & ones;
+#else
+  return (key - nans) & ones;
+#endif
 }
 
-static void TIM_SORT_MERGE(SORT_TYPE *dst, const TIM_SORT_RUN_T *stack, const int stack_curr,
-                           TEMP_STORAGE_T *store) {
-  const size_t A = stack[stack_curr - 2].length;
-  const size_t B = stack[stack_curr - 1].length;
-  const size_t curr = stack[stack_curr - 2].start;
-  SORT_TYPE *storage;
-  size_t i, j, k;
-  TIM_SORT_RESIZE(store, MIN(A, B));
-  storage = store->storage;
+/* Insertion sort on the keys, for float arrays too small to pay for the histograms:
+   SORT_CMP doesn't know where NaNs and -0.0 go in total order. */
+static void RADIX_SORT_INSERTION(SORT_TYPE *dst, const size_t size) {
+  size_t i, j;
 
-  /* left merge */
-  if (A < B) {
-    SORT_TYPE_CPY(storage, &dst[curr], A);
-    i = 0;
-    j = curr + A;
+  for (i = 1; i < size; i++) {
+    const SORT_TYPE x = dst[i];
+    const uint64_t key = RADIX_SORT_KEY(x);
 
-    for (k = curr; k < curr + A + B; k++) {
-      if ((i < A) && (j < curr + A + B)) {
-        if (SORT_CMP(storage[i], dst[j]) <= 0) {
-          dst[k] = storage[i++];
-        } else {
-          dst[k] = dst[j++];
-        }
-      } else if (i < A) {
-        dst[k] = storage[i++];
-      } else {
-        break;
-      }
+    for (j = i; (j > 0) && (RADIX_SORT_KEY(dst[j - 1]) > key); j--) {
+      dst[j] = dst[j - 1];
     }
-  } else {
-    /* right merge */
-    SORT_TYPE_CPY(storage, &dst[curr + A], B);
-    i = B;
-    j = curr + A;
-    k = curr + A + B;
 
-    while (k-- > curr) {
-      if ((i > 0) && (j > curr)) {
-        if (SORT_CMP(dst[j - 1], storage[i - 1]) > 0) {
-          dst[k] = dst[--j];
-        } else {
-          dst[k] = storage[--i];
-        }
-      } else if (i > 0) {
-        dst[k] = storage[--i];
-      } else {
-        break;
-      }
-    }
+    dst[j] = x;
   }
 }
 
-static int TIM_SORT_COLLAPSE(SORT_TYPE *dst, TIM_SORT_RUN_T *stack, int stack_curr,
-                             TEMP_STORAGE_T *store, const size_t size) {
-  while (1) {
-    size_t A, B, C, D;
-    int ABC, BCD, CD;
-
-    /* if the stack only has one thing on it, we are done with the collapse */
-    if (stack_curr <= 1) {
-      break;
-    }
-
-    /* if this is the last merge, just do it */
-    if ((stack_curr == 2) && (stack[0].length + stack[1].length == size)) {
-      TIM_SORT_MERGE(dst, stack, stack_curr, store);
-      stack[0].length += stack[1].length;
-      stack_curr--;
-      break;
-    }
-    /* check if the invariant is off for a stack of 2 elements */
-    else if ((stack_curr == 2) && (stack[0].length <= stack[1].length)) {
-      TIM_SORT_MERGE(dst, stack, stack_curr, store);
-      stack[0].length += stack[1].length;
-      stack_curr--;
-      break;
-    } else if (stack_curr == 2) {
-      break;
-    }
+/* Count every byte of the keys in src[begin, end) into counts[byte][value]. */
+static void RADIX_SORT_HISTOGRAM(SORT_TYPE *src, const size_t begin, const size_t end,
+                                 size_t *counts) {
+  size_t i;
+  unsigned d;
+  memset(counts, 0, sizeof(SORT_TYPE) * 256 * sizeof(size_t));
 
-    B = stack[stack_curr - 3].length;
-    C = stack[stack_curr - 2].length;
-    D = stack[stack_curr - 1].length;
+  for (i = begin; i < end; i++) {
+    const uint64_t key = RADIX_SORT_KEY(src[i]);
 
-    if (stack_curr >= 4) {
-      A = stack[stack_curr - 4].length;
-      ABC = (A <= B + C);
-    } else {
-      ABC = 0;
+    for (d = 0; d < sizeof(SORT_TYPE); d++) {
+      counts[d * 256 + ((key >> (8 * d)) & 255)]++;
     }
+  }
+}
 
-    BCD = (B <= C + D) || ABC;
-    CD = (C <= D);
+/* Move src[begin, end) to out by byte digit of their keys; offsets[v] is where the
+   next element with byte value v goes, and is advanced past what was written. */
+static void RADIX_SORT_SCATTER(SORT_TYPE *src, SORT_TYPE *out, const size_t begin,
+                               const size_t end, const unsigned digit, size_t *offsets) {
+  SORT_TYPE lines[256 * SORT_RADIX_LINE];
+  size_t fill[256];
+  const unsigned shift = 8 * digit;
+  size_t i;
+  memset(fill, 0, sizeof(fill));
 
-    /* Both invariants are good */
-    if (!BCD && !CD) {
-      break;
-    }
+  for (i = begin; i < end; i++) {
+    const size_t v = (size_t)((RADIX_SORT_KEY(src[i]) >> shift) & 255);
+    lines[v * SORT_RADIX_LINE + fill[v]] = src[i];
 
-    /* left merge */
-    if (BCD && !CD) {
-      TIM_SORT_MERGE(dst, stack, stack_curr - 1, store);
-      stack[stack_curr - 3].length += stack[stack_curr - 2].length;
-      stack[stack_curr - 2] = stack[stack_curr - 1];
-      stack_curr--;
-    } else {
-      /* right merge */
-      TIM_SORT_MERGE(dst, stack, stack_curr, store);
-      stack[stack_curr - 2].length += stack[stack_curr - 1].length;
-      stack_curr--;
+    if (++fill[v] == SORT_RADIX_LINE) {
+      SORT_TYPE_CPY(out + offsets[v], lines + v * SORT_RADIX_LINE, SORT_RADIX_LINE);
+      offsets[v] += SORT_RADIX_LINE;
+      fill[v] = 0;
     }
   }
 
-  return stack_curr;
+  for (i = 0; i < 256; i++) {
+    SORT_TYPE_CPY(out + offsets[i], lines + i * SORT_RADIX_LINE, fill[i]);
+    offsets[i] += fill[i];
+  }
 }
 
-static __inline int PUSH_NEXT(SORT_TYPE *dst,
-                              const size_t size,
-                              TEMP_STORAGE_T *store,
-                              const size_t minrun,
-                              TIM_SORT_RUN_T *run_stack,
-                              size_t *stack_curr,
-                              size_t *curr) {
-  size_t len = COUNT_RUN(dst, *curr, size);
-  size_t run = minrun;
+SORT_DEF void RADIX_SORT(SORT_TYPE *dst, const size_t size) {
+  size_t counts[sizeof(SORT_TYPE) * 256];
+  size_t offsets[256];
+  SORT_TYPE *buffer, *src, *out, *tmp;
+  unsigned d;
+  size_t i;
 
-  if (run > size - *curr) {
-    run = size - *curr;
+  /* too small to pay for the histograms, or not a type with radix keys */
+  if ((size < 256) && SORT_RADIX_FLOAT) {
+    RADIX_SORT_INSERTION(dst, size);
+    return;
   }
 
-  if (run > len) {
-    BINARY_INSERTION_SORT_START(&dst[*curr], len, run);
-    len = run;
+  if ((size < 256) || !(SORT_RADIX_INTEGER || SORT_RADIX_FLOAT)) {
+    QUICK_SORT(dst, size);
+    return;
   }
 
-  run_stack[*stack_curr].start = *curr;
-  run_stack[*stack_curr].length = len;
-  (*stack_curr)++;
-  *curr += len;
+  buffer = SORT_NEW_BUFFER(size);
 
-  if (*curr == size) {
-    /* finish up */
-    while (*stack_curr > 1) {
-      TIM_SORT_MERGE(dst, run_stack, (int)*stack_curr, store);
-      run_stack[*stack_curr - 2].length += run_stack[*stack_curr - 1].length;
-      (*stack_curr)--;
+  if (buffer == NULL) {
+    fprintf(stderr, "Error allocating temporary storage for radix sort: need %lu bytes",
+            (unsigned long)(sizeof(SORT_TYPE) * size));
+    exit(1);
+  }
+
+  RADIX_SORT_HISTOGRAM(dst, 0, size, counts);
+  src = dst;
+  out = buffer;
+
+  for (d = 0; d < sizeof(SORT_TYPE); d++) {
+    size_t *count = counts + d * 256;
+    size_t sum = 0;
+
+    if (count[(RADIX_SORT_KEY(src[0]) >> (8 * d)) & 255] == size) {
+      continue;
     }
 
-    if (store->storage != NULL) {
-      free(store->storage);
-      store->storage = NULL;
+    for (i = 0; i < 256; i++) {
+      offsets[i] = sum;
+      sum += count[i];
     }
 
-    return 0;
+    RADIX_SORT_SCATTER(src, out, 0, size, d, offsets);
+    tmp = src;
+    src = out;
+    out = tmp;
   }
 
-  return 1;
+  if (src != dst) {
+    SORT_TYPE_CPY(dst, src, size);
+  }
+
+  SORT_DELETE_BUFFER(buffer);
 }
 
-SORT_DEF void TIM_SORT(SORT_TYPE *dst, const size_t size) {
-  size_t minrun;
-  TEMP_STORAGE_T _store, *store;
-  TIM_SORT_RUN_T run_stack[TIM_SORT_STACK_SIZE];
-  size_t stack_curr = 0;
-  size_t curr = 0;
+#endif /* SORT_PRIMITIVE */
 
-  /* don't bother sorting an array of size 1 */
-  if (size <= 1) {
-    return;
-  }
+#ifdef SORT_STRING
 
-  if (size < 64) {
-    SMALL_STABLE_SORT(dst, size);
-    return;
-  }
+/* string sort: for when SORT_TYPE points to NUL-terminated strings (and SORT_STRING
+   is defined), a multikey quicksort in strcmp order, which never calls SORT_CMP.
+   Every string's next 8 characters are cached in a word next to it, so one
+   comparison of words does 8 characters, and the strings themselves are only read
+   to refill the words of the ranges that tie on them.  If lcp isn't NULL, lcp[i]
+   gets the length of the common prefix of the sorted dst[i - 1] and dst[i] (the
+   helpers below leave lcp[0] of their range to whoever cut it out). */
+#define SORT_STRING_CHARS(x) ((const unsigned char *)(x))
 
-  /* compute the minimum run length */
-  minrun = compute_minrun(size);
-  /* temporary storage for merges */
-  store = &_store;
-  store->alloc = 0;
-  store->storage = NULL;
+static __inline void STRING_SORT_LOAD(SORT_TYPE *dst, uint64_t *cache, const size_t size,
+                                      const size_t depth) {
+  size_t i;
 
-  if (!PUSH_NEXT(dst, size, store, minrun, run_stack, &stack_curr, &curr)) {
-    return;
+  for (i = 0; i < size; i++) {
+    cache[i] = sort_string_word(SORT_STRING_CHARS(dst[i]) + depth);
   }
+}
 
-  if (!PUSH_NEXT(dst, size, store, minrun, run_stack, &stack_curr, &curr)) {
-    return;
-  }
+/* Three-way partition of strings which agree on their first depth
+   characters, on the median of three of their words: on return [0, *lt) have a
+   smaller word, [*lt, *gt) the same and [*gt, size) a bigger one.  Sets the lcp of
+   the strings either side of the two cuts, and of the equal part when its strings
+   have all ended there, which is when this returns 0. */
+static int STRING_SORT_PARTITION(SORT_TYPE *dst, uint64_t *cache, const size_t size,
+                                 const size_t depth, size_t *lcp, size_t *lt, size_t *gt) {
+  const uint64_t a = cache[0];
+  const uint64_t b = cache[size >> 1];
+  const uint64_t c = cache[size - 1];
+  const uint64_t pivot = (a < b) ? ((b < c) ? b : ((a < c) ? c : a)) :
+                         ((a < c) ? a : ((b < c) ? c : b));
+  uint64_t max_less = 0;
+  uint64_t min_more = ~(uint64_t)0;
+  size_t less = 0;
+  size_t more = size;
+  size_t i = 0;
 
-  if (!PUSH_NEXT(dst, size, store, minrun, run_stack, &stack_curr, &curr)) {
-    return;
+  while (i < more) {
+    const uint64_t word = cache[i];
+
+    if (word < pivot) {
+      SORT_SWAP(dst[i], dst[less]);
+      cache[i] = cache[less];
+      cache[less++] = word;
+      i++;
+      max_less = MAX(max_less, word);
+    } else if (word > pivot) {
+      more--;
+      SORT_SWAP(dst[i], dst[more]);
+      cache[i] = cache[more];
+      cache[more] = word;
+      min_more = MIN(min_more, word);
+    } else {
+      i++;
+    }
   }
 
-  while (1) {
-    if (!CHECK_INVARIANT(run_stack, (int)stack_curr)) {
-      stack_curr = TIM_SORT_COLLAPSE(dst, run_stack, (int)stack_curr, store, size);
-      continue;
+  *lt = less;
+  *gt = more;
+
+  if (lcp != NULL) {
+    if (less > 0) {
+      lcp[less] = depth + sort_string_common(max_less, pivot);
     }
 
-    if (!PUSH_NEXT(dst, size, store, minrun, run_stack, &stack_curr, &curr)) {
-      return;
+    if (more < size) {
+      lcp[more] = depth + sort_string_common(pivot, min_more);
+    }
+
+    if ((pivot & 0xFF) == 0) {
+      const size_t length = depth + sort_string_length(pivot);
+
+      for (i = less + 1; i < more; i++) {
+        lcp[i] = length;
+      }
     }
   }
+
+  return (pivot & 0xFF) != 0;
 }
 
-/* heap sort: based on wikipedia */
+/* Insertion sort of strings that agree on their first depth characters. */
+static void STRING_SORT_INSERTION(SORT_TYPE *dst, uint64_t *cache, const size_t size,
+                                  const size_t depth, size_t *lcp) {
+  size_t i, j;
 
-static __inline void HEAP_SIFT_DOWN(SORT_TYPE *dst, const size_t start, const size_t end) {
-  size_t root = start;
+  for (i = 1; i < size; i++) {
+    SORT_TYPE s = dst[i];
+    const uint64_t word = cache[i];
 
-  while ((root << 1) <= end) {
-    size_t child = root << 1;
+    for (j = i; j > 0; j--) {
+      if ((cache[j - 1] < word) || ((cache[j - 1] == word) && (((word & 0xFF) == 0) ||
+                                    (strcmp((const char *)SORT_STRING_CHARS(dst[j - 1]) + depth + 8,
+                                        (const char *)SORT_STRING_CHARS(s) + depth + 8) <= 0)))) {
+        break;
+      }
 
-    if ((child < end) && (SORT_CMP(dst[child], dst[child + 1]) < 0)) {
-      child++;
+      dst[j] = dst[j - 1];
+      cache[j] = cache[j - 1];
     }
 
-    if (SORT_CMP(dst[root], dst[child]) < 0) {
-      SORT_SWAP(dst[root], dst[child]);
-      root = child;
+    dst[j] = s;
+    cache[j] = word;
+  }
+
+  if (lcp == NULL) {
+    return;
+  }
+
+  for (i = 1; i < size; i++) {
+    if (cache[i - 1] != cache[i]) {
+      lcp[i] = depth + sort_string_common(cache[i - 1], cache[i]);
+    } else if ((cache[i] & 0xFF) == 0) {
+      lcp[i] = depth + sort_string_length(cache[i]);
     } else {
-      return;
+      const unsigned char *a = SORT_STRING_CHARS(dst[i - 1]);
+      const unsigned char *b = SORT_STRING_CHARS(dst[i]);
+      j = depth + 8;
+
+      while ((a[j] != 0) && (a[j] == b[j])) {
+        j++;
+      }
+
+      lcp[i] = j;
     }
   }
 }
 
-static __inline void HEAPIFY(SORT_TYPE *dst, const size_t size) {
-  size_t start = size >> 1;
+/* Sorts strings that agree on their first depth characters and whose words hold
+   the next 8; recurses on the two smaller parts of every partition. */
+static void STRING_SORT_MKQS(SORT_TYPE *dst, uint64_t *cache, size_t size, size_t depth,
+                             size_t *lcp) {
+  size_t lt, gt;
 
-  while (1) {
-    HEAP_SIFT_DOWN(dst, start, size - 1);
+  while (size > SORT_STRING_SMALL) {
+    const int equal_left = STRING_SORT_PARTITION(dst, cache, size, depth, lcp, &lt, &gt);
+    /* an equal part that has ended is already done */
+    const size_t eq = equal_left ? gt - lt : 0;
+    const size_t more = size - gt;
 
-    if (start == 0) {
-      break;
+    if (equal_left) {
+      STRING_SORT_LOAD(dst + lt, cache + lt, eq, depth + 8);
     }
 
-    start--;
+    if ((lt >= eq) && (lt >= more)) {
+      STRING_SORT_MKQS(dst + lt, cache + lt, eq, depth + 8, lcp ? lcp + lt : NULL);
+      STRING_SORT_MKQS(dst + gt, cache + gt, more, depth, lcp ? lcp + gt : NULL);
+      size = lt;
+    } else if (eq >= more) {
+      STRING_SORT_MKQS(dst, cache, lt, depth, lcp);
+      STRING_SORT_MKQS(dst + gt, cache + gt, more, depth, lcp ? lcp + gt : NULL);
+      dst += lt;
+      cache += lt;
+      lcp = lcp ? lcp + lt : NULL;
+      size = eq;
+      depth += 8;
+    } else {
+      STRING_SORT_MKQS(dst, cache, lt, depth, lcp);
+      STRING_SORT_MKQS(dst + lt, cache + lt, eq, depth + 8, lcp ? lcp + lt : NULL);
+      dst += gt;
+      cache += gt;
+      lcp = lcp ? lcp + gt : NULL;
+      size = more;
+    }
   }
+
+  STRING_SORT_INSERTION(dst, cache, size, depth, lcp);
 }
 
-SORT_DEF void HEAP_SORT(SORT_TYPE *dst, const size_t size) {
-  size_t end = size - 1;
+SORT_DEF void STRING_SORT_LCP(SORT_TYPE *dst, const size_t size, size_t *lcp) {
+  uint64_t *cache;
+
+  if (lcp != NULL && size > 0) {
+    lcp[0] = 0;
+  }
 
-  /* don't bother sorting an array of size <= 1 */
   if (size <= 1) {
     return;
   }
 
-  HEAPIFY(dst, size);
+  cache = (uint64_t *)malloc(size * sizeof(uint64_t));
 
-  while (end > 0) {
-    SORT_SWAP(dst[end], dst[0]);
-    HEAP_SIFT_DOWN(dst, 0, end - 1);
-    end--;
+  if (cache == NULL) {
+    fprintf(stderr, "Error allocating temporary storage for string sort: need %lu bytes",
+            (unsigned long)(size * sizeof(uint64_t)));
+    exit(1);
   }
+
+  STRING_SORT_LOAD(dst, cache, size, 0);
+  STRING_SORT_MKQS(dst, cache, size, 0, lcp);
+  free(cache);
+}
+
+SORT_DEF void STRING_SORT(SORT_TYPE *dst, const size_t size) {
+  STRING_SORT_LCP(dst, size, NULL);
 }
 
+#endif /* SORT_STRING */
+
 #ifdef SORT_EXTRA
 #include "sort_extra.h"
 #endif
 
+#ifdef SORT_PARALLEL
+#include "sort_parallel.h"
+#endif
+
 #undef SORT_SAFE_CPY
 #undef SORT_TYPE_CPY
 #undef SORT_TYPE_MOVE
@@ -1789,6 +3671,16 @@ SORT_DEF void HEAP_SORT(SORT_TYPE *dst, const size_t size) {
 #undef SORT_MAKE_STR
 #undef SORT_NAME
 #undef SORT_TYPE
+#undef SORT_PRIMITIVE
+#undef SORT_BLOCK_PARTITION
+#undef SORT_PDQSORT
+#undef SORT_FAT_PARTITION
+#undef SORT_NAN_FIRST
+#undef SMALL_SORT_BND
+#undef SMALL_SORT
+#undef SMALL_STABLE_SORT
+#undef SORT_STRING
+#undef SORT_STRING_CHARS
 #undef SORT_CMP
 #undef TEMP_STORAGE_T
 #undef TIM_SORT_RUN_T
@@ -1800,6 +3692,9 @@ SORT_DEF void HEAP_SORT(SORT_TYPE *dst, const size_t size) {
 #undef BINARY_INSERTION_SORT_START
 #undef BINARY_INSERTION_SORT
 #undef REVERSE_ELEMENTS
+#undef SORTED_UNTIL
+#undef IS_SORTED_UNTIL
+#undef PRESORTED
 #undef COUNT_RUN
 #undef TIM_SORT
 #undef TIM_SORT_RESIZE
@@ -0,0 +1,14344 @@
+/* Copyright (c) 2010-2024 Christopher Swenson. */
+/* Copyright (c) 2012 Google Inc. All Rights Reserved. */
+
+/* Sorting networks for 17 to 64 elements, included by sort.h when SMALL_SORT_BND is
+   more than 16.  Written by generate_bitonic_sort.py, which says how they are made:
+   change that rather than this. */
+
+#define BITONIC_SORT_17          SORT_MAKE_STR(bitonic_sort_17)
+static __inline void BITONIC_SORT_17(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[2], dst[5]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[0], dst[3]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[5], dst[8]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[3], dst[6]);
+  SORT_CSWAP(dst[4], dst[7]);
+  SORT_CSWAP(dst[2], dst[5]);
+  SORT_CSWAP(dst[10], dst[13]);
+  SORT_CSWAP(dst[12], dst[15]);
+  SORT_CSWAP(dst[0], dst[3]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+}
+
+#define BITONIC_SORT_18          SORT_MAKE_STR(bitonic_sort_18)
+static __inline void BITONIC_SORT_18(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[4], dst[9]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[2], dst[7]);
+  SORT_CSWAP(dst[1], dst[6]);
+  SORT_CSWAP(dst[0], dst[5]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[0], dst[3]);
+  SORT_CSWAP(dst[5], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[3], dst[6]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[13], dst[16]);
+  SORT_CSWAP(dst[2], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[4], dst[7]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+}
+
+#define BITONIC_SORT_19          SORT_MAKE_STR(bitonic_sort_19)
+static __inline void BITONIC_SORT_19(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[12], dst[15]);
+  SORT_CSWAP(dst[14], dst[17]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[10]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+}
+
+#define BITONIC_SORT_20          SORT_MAKE_STR(bitonic_sort_20)
+static __inline void BITONIC_SORT_20(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[13], dst[16]);
+  SORT_CSWAP(dst[15], dst[18]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[10]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+}
+
+#define BITONIC_SORT_21          SORT_MAKE_STR(bitonic_sort_21)
+static __inline void BITONIC_SORT_21(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[1], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[8]);
+  SORT_CSWAP(dst[0], dst[12]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[11]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[6], dst[12]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[4], dst[9]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[1], dst[7]);
+  SORT_CSWAP(dst[14], dst[17]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[4], dst[7]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[0], dst[5]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[2], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+}
+
+#define BITONIC_SORT_22          SORT_MAKE_STR(bitonic_sort_22)
+static __inline void BITONIC_SORT_22(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[16], dst[21]);
+  SORT_CSWAP(dst[15], dst[20]);
+  SORT_CSWAP(dst[14], dst[19]);
+  SORT_CSWAP(dst[13], dst[18]);
+  SORT_CSWAP(dst[12], dst[17]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[13], dst[16]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[12], dst[15]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[15], dst[18]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[14], dst[17]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[10]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+}
+
+#define BITONIC_SORT_23          SORT_MAKE_STR(bitonic_sort_23)
+static __inline void BITONIC_SORT_23(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+}
+
+#define BITONIC_SORT_24          SORT_MAKE_STR(bitonic_sort_24)
+static __inline void BITONIC_SORT_24(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[19], dst[22]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+}
+
+#define BITONIC_SORT_25          SORT_MAKE_STR(bitonic_sort_25)
+static __inline void BITONIC_SORT_25(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[21], dst[24]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[19], dst[22]);
+  SORT_CSWAP(dst[20], dst[23]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+}
+
+#define BITONIC_SORT_26          SORT_MAKE_STR(bitonic_sort_26)
+static __inline void BITONIC_SORT_26(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[20], dst[25]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[18], dst[23]);
+  SORT_CSWAP(dst[17], dst[22]);
+  SORT_CSWAP(dst[16], dst[21]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[21], dst[24]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[19], dst[22]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[23]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+}
+
+#define BITONIC_SORT_27          SORT_MAKE_STR(bitonic_sort_27)
+static __inline void BITONIC_SORT_27(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[26]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+}
+
+#define BITONIC_SORT_28          SORT_MAKE_STR(bitonic_sort_28)
+static __inline void BITONIC_SORT_28(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[26]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+}
+
+#define BITONIC_SORT_29          SORT_MAKE_STR(bitonic_sort_29)
+static __inline void BITONIC_SORT_29(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[17], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[24]);
+  SORT_CSWAP(dst[16], dst[28]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[27]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[22], dst[28]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[20], dst[25]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[17], dst[23]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[23]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[16], dst[21]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+}
+
+#define BITONIC_SORT_30          SORT_MAKE_STR(bitonic_sort_30)
+static __inline void BITONIC_SORT_30(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+}
+
+#define BITONIC_SORT_31          SORT_MAKE_STR(bitonic_sort_31)
+static __inline void BITONIC_SORT_31(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+}
+
+#define BITONIC_SORT_32          SORT_MAKE_STR(bitonic_sort_32)
+static __inline void BITONIC_SORT_32(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+}
+
+#define BITONIC_SORT_33          SORT_MAKE_STR(bitonic_sort_33)
+static __inline void BITONIC_SORT_33(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[2], dst[5]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[0], dst[3]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[5], dst[8]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[3], dst[6]);
+  SORT_CSWAP(dst[4], dst[7]);
+  SORT_CSWAP(dst[2], dst[5]);
+  SORT_CSWAP(dst[10], dst[13]);
+  SORT_CSWAP(dst[12], dst[15]);
+  SORT_CSWAP(dst[22], dst[27]);
+  SORT_CSWAP(dst[23], dst[26]);
+  SORT_CSWAP(dst[20], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[0], dst[3]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[24], dst[30]);
+  SORT_CSWAP(dst[19], dst[25]);
+  SORT_CSWAP(dst[28], dst[31]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[20], dst[25]);
+  SORT_CSWAP(dst[24], dst[29]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+}
+
+#define BITONIC_SORT_34          SORT_MAKE_STR(bitonic_sort_34)
+static __inline void BITONIC_SORT_34(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[4], dst[9]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[2], dst[7]);
+  SORT_CSWAP(dst[1], dst[6]);
+  SORT_CSWAP(dst[0], dst[5]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[0], dst[3]);
+  SORT_CSWAP(dst[5], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[3], dst[6]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[13], dst[16]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[24], dst[27]);
+  SORT_CSWAP(dst[21], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[2], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[4], dst[7]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[19], dst[22]);
+  SORT_CSWAP(dst[25], dst[31]);
+  SORT_CSWAP(dst[20], dst[26]);
+  SORT_CSWAP(dst[29], dst[32]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[25], dst[30]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+}
+
+#define BITONIC_SORT_35          SORT_MAKE_STR(bitonic_sort_35)
+static __inline void BITONIC_SORT_35(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[12], dst[15]);
+  SORT_CSWAP(dst[14], dst[17]);
+  SORT_CSWAP(dst[24], dst[29]);
+  SORT_CSWAP(dst[25], dst[28]);
+  SORT_CSWAP(dst[22], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[20], dst[23]);
+  SORT_CSWAP(dst[26], dst[32]);
+  SORT_CSWAP(dst[21], dst[27]);
+  SORT_CSWAP(dst[30], dst[33]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[10]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[22], dst[27]);
+  SORT_CSWAP(dst[26], dst[31]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+}
+
+#define BITONIC_SORT_36          SORT_MAKE_STR(bitonic_sort_36)
+static __inline void BITONIC_SORT_36(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[13], dst[16]);
+  SORT_CSWAP(dst[15], dst[18]);
+  SORT_CSWAP(dst[25], dst[30]);
+  SORT_CSWAP(dst[26], dst[29]);
+  SORT_CSWAP(dst[23], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[21], dst[24]);
+  SORT_CSWAP(dst[27], dst[33]);
+  SORT_CSWAP(dst[22], dst[28]);
+  SORT_CSWAP(dst[31], dst[34]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[10]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[27], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+}
+
+#define BITONIC_SORT_37          SORT_MAKE_STR(bitonic_sort_37)
+static __inline void BITONIC_SORT_37(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[1], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[8]);
+  SORT_CSWAP(dst[0], dst[12]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[11]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[6], dst[12]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[4], dst[9]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[1], dst[7]);
+  SORT_CSWAP(dst[14], dst[17]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[26], dst[31]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[24], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[4], dst[7]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[0], dst[5]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[28], dst[34]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[32], dst[35]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[2], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[24], dst[29]);
+  SORT_CSWAP(dst[28], dst[33]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+}
+
+#define BITONIC_SORT_38          SORT_MAKE_STR(bitonic_sort_38)
+static __inline void BITONIC_SORT_38(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[16], dst[21]);
+  SORT_CSWAP(dst[15], dst[20]);
+  SORT_CSWAP(dst[14], dst[19]);
+  SORT_CSWAP(dst[13], dst[18]);
+  SORT_CSWAP(dst[12], dst[17]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[13], dst[16]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[12], dst[15]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[15], dst[18]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[27], dst[32]);
+  SORT_CSWAP(dst[28], dst[31]);
+  SORT_CSWAP(dst[25], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[14], dst[17]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[23], dst[26]);
+  SORT_CSWAP(dst[29], dst[35]);
+  SORT_CSWAP(dst[24], dst[30]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[10]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[25], dst[30]);
+  SORT_CSWAP(dst[29], dst[34]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+}
+
+#define BITONIC_SORT_39          SORT_MAKE_STR(bitonic_sort_39)
+static __inline void BITONIC_SORT_39(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[28], dst[33]);
+  SORT_CSWAP(dst[29], dst[32]);
+  SORT_CSWAP(dst[26], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[24], dst[27]);
+  SORT_CSWAP(dst[30], dst[36]);
+  SORT_CSWAP(dst[25], dst[31]);
+  SORT_CSWAP(dst[34], dst[37]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[26], dst[31]);
+  SORT_CSWAP(dst[30], dst[35]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+}
+
+#define BITONIC_SORT_40          SORT_MAKE_STR(bitonic_sort_40)
+static __inline void BITONIC_SORT_40(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[19], dst[22]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[29], dst[34]);
+  SORT_CSWAP(dst[30], dst[33]);
+  SORT_CSWAP(dst[27], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[25], dst[28]);
+  SORT_CSWAP(dst[31], dst[37]);
+  SORT_CSWAP(dst[26], dst[32]);
+  SORT_CSWAP(dst[35], dst[38]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[27], dst[32]);
+  SORT_CSWAP(dst[31], dst[36]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+}
+
+#define BITONIC_SORT_41          SORT_MAKE_STR(bitonic_sort_41)
+static __inline void BITONIC_SORT_41(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[21], dst[24]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[19], dst[22]);
+  SORT_CSWAP(dst[20], dst[23]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[30], dst[35]);
+  SORT_CSWAP(dst[31], dst[34]);
+  SORT_CSWAP(dst[28], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[29]);
+  SORT_CSWAP(dst[32], dst[38]);
+  SORT_CSWAP(dst[27], dst[33]);
+  SORT_CSWAP(dst[36], dst[39]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[28], dst[33]);
+  SORT_CSWAP(dst[32], dst[37]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+}
+
+#define BITONIC_SORT_42          SORT_MAKE_STR(bitonic_sort_42)
+static __inline void BITONIC_SORT_42(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[20], dst[25]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[18], dst[23]);
+  SORT_CSWAP(dst[17], dst[22]);
+  SORT_CSWAP(dst[16], dst[21]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[16], dst[19]);
+  SORT_CSWAP(dst[21], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[19], dst[22]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[31], dst[36]);
+  SORT_CSWAP(dst[32], dst[35]);
+  SORT_CSWAP(dst[29], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[23]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[33], dst[39]);
+  SORT_CSWAP(dst[28], dst[34]);
+  SORT_CSWAP(dst[37], dst[40]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[29], dst[34]);
+  SORT_CSWAP(dst[33], dst[38]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+}
+
+#define BITONIC_SORT_43          SORT_MAKE_STR(bitonic_sort_43)
+static __inline void BITONIC_SORT_43(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[32], dst[37]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[30], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[28], dst[31]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[29], dst[35]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[26]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[30], dst[35]);
+  SORT_CSWAP(dst[34], dst[39]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+}
+
+#define BITONIC_SORT_44          SORT_MAKE_STR(bitonic_sort_44)
+static __inline void BITONIC_SORT_44(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[33], dst[38]);
+  SORT_CSWAP(dst[34], dst[37]);
+  SORT_CSWAP(dst[31], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[29], dst[32]);
+  SORT_CSWAP(dst[35], dst[41]);
+  SORT_CSWAP(dst[30], dst[36]);
+  SORT_CSWAP(dst[39], dst[42]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[26]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[31], dst[36]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+}
+
+#define BITONIC_SORT_45          SORT_MAKE_STR(bitonic_sort_45)
+static __inline void BITONIC_SORT_45(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[17], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[24]);
+  SORT_CSWAP(dst[16], dst[28]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[27]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[22], dst[28]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[20], dst[25]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[17], dst[23]);
+  SORT_CSWAP(dst[34], dst[39]);
+  SORT_CSWAP(dst[35], dst[38]);
+  SORT_CSWAP(dst[32], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[20], dst[23]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[16], dst[21]);
+  SORT_CSWAP(dst[30], dst[33]);
+  SORT_CSWAP(dst[36], dst[42]);
+  SORT_CSWAP(dst[31], dst[37]);
+  SORT_CSWAP(dst[40], dst[43]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[21]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[32], dst[37]);
+  SORT_CSWAP(dst[36], dst[41]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+}
+
+#define BITONIC_SORT_46          SORT_MAKE_STR(bitonic_sort_46)
+static __inline void BITONIC_SORT_46(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[36], dst[39]);
+  SORT_CSWAP(dst[33], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[31], dst[34]);
+  SORT_CSWAP(dst[37], dst[43]);
+  SORT_CSWAP(dst[32], dst[38]);
+  SORT_CSWAP(dst[41], dst[44]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[33], dst[38]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+}
+
+#define BITONIC_SORT_47          SORT_MAKE_STR(bitonic_sort_47)
+static __inline void BITONIC_SORT_47(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[36], dst[41]);
+  SORT_CSWAP(dst[37], dst[40]);
+  SORT_CSWAP(dst[34], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[32], dst[35]);
+  SORT_CSWAP(dst[38], dst[44]);
+  SORT_CSWAP(dst[33], dst[39]);
+  SORT_CSWAP(dst[42], dst[45]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[34], dst[39]);
+  SORT_CSWAP(dst[38], dst[43]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+}
+
+#define BITONIC_SORT_48          SORT_MAKE_STR(bitonic_sort_48)
+static __inline void BITONIC_SORT_48(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+}
+
+#define BITONIC_SORT_49          SORT_MAKE_STR(bitonic_sort_49)
+static __inline void BITONIC_SORT_49(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[34], dst[37]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[35]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[37], dst[40]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[35], dst[38]);
+  SORT_CSWAP(dst[36], dst[39]);
+  SORT_CSWAP(dst[34], dst[37]);
+  SORT_CSWAP(dst[42], dst[45]);
+  SORT_CSWAP(dst[44], dst[47]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[32], dst[35]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+}
+
+#define BITONIC_SORT_50          SORT_MAKE_STR(bitonic_sort_50)
+static __inline void BITONIC_SORT_50(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[36], dst[41]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[34], dst[39]);
+  SORT_CSWAP(dst[33], dst[38]);
+  SORT_CSWAP(dst[32], dst[37]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[32], dst[35]);
+  SORT_CSWAP(dst[37], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[35], dst[38]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[45], dst[48]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[34], dst[37]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[36], dst[39]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+}
+
+#define BITONIC_SORT_51          SORT_MAKE_STR(bitonic_sort_51)
+static __inline void BITONIC_SORT_51(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[44], dst[47]);
+  SORT_CSWAP(dst[46], dst[49]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[42]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+}
+
+#define BITONIC_SORT_52          SORT_MAKE_STR(bitonic_sort_52)
+static __inline void BITONIC_SORT_52(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[45], dst[48]);
+  SORT_CSWAP(dst[47], dst[50]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[42]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+}
+
+#define BITONIC_SORT_53          SORT_MAKE_STR(bitonic_sort_53)
+static __inline void BITONIC_SORT_53(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[33], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[40]);
+  SORT_CSWAP(dst[32], dst[44]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[43]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[38], dst[44]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[36], dst[41]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[33], dst[39]);
+  SORT_CSWAP(dst[46], dst[49]);
+  SORT_CSWAP(dst[48], dst[51]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[36], dst[39]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[32], dst[37]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[37]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+}
+
+#define BITONIC_SORT_54          SORT_MAKE_STR(bitonic_sort_54)
+static __inline void BITONIC_SORT_54(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[48], dst[53]);
+  SORT_CSWAP(dst[47], dst[52]);
+  SORT_CSWAP(dst[46], dst[51]);
+  SORT_CSWAP(dst[45], dst[50]);
+  SORT_CSWAP(dst[44], dst[49]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[45], dst[48]);
+  SORT_CSWAP(dst[50], dst[53]);
+  SORT_CSWAP(dst[44], dst[47]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[47], dst[50]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[46], dst[49]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[48], dst[51]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[42]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+}
+
+#define BITONIC_SORT_55          SORT_MAKE_STR(bitonic_sort_55)
+static __inline void BITONIC_SORT_55(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[48], dst[51]);
+  SORT_CSWAP(dst[50], dst[53]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+}
+
+#define BITONIC_SORT_56          SORT_MAKE_STR(bitonic_sort_56)
+static __inline void BITONIC_SORT_56(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[53], dst[55]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[51], dst[55]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[51], dst[54]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[39], dst[55]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[23], dst[55]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+}
+
+#define BITONIC_SORT_57          SORT_MAKE_STR(bitonic_sort_57)
+static __inline void BITONIC_SORT_57(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[50], dst[53]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[48], dst[51]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[53], dst[56]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[51], dst[54]);
+  SORT_CSWAP(dst[52], dst[55]);
+  SORT_CSWAP(dst[50], dst[53]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[48], dst[51]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[53], dst[55]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[40], dst[56]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[39], dst[55]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[24], dst[56]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[23], dst[55]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+}
+
+#define BITONIC_SORT_58          SORT_MAKE_STR(bitonic_sort_58)
+static __inline void BITONIC_SORT_58(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[52], dst[57]);
+  SORT_CSWAP(dst[51], dst[56]);
+  SORT_CSWAP(dst[50], dst[55]);
+  SORT_CSWAP(dst[49], dst[54]);
+  SORT_CSWAP(dst[48], dst[53]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[54], dst[57]);
+  SORT_CSWAP(dst[48], dst[51]);
+  SORT_CSWAP(dst[53], dst[56]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[51], dst[54]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[53], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[50], dst[53]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[52], dst[55]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[40], dst[56]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[41], dst[57]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[39], dst[55]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[24], dst[56]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[25], dst[57]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[23], dst[55]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+}
+
+#define BITONIC_SORT_59          SORT_MAKE_STR(bitonic_sort_59)
+static __inline void BITONIC_SORT_59(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[53], dst[55]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[56], dst[58]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[51], dst[55]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[51], dst[56]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[55], dst[58]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[42], dst[58]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[40], dst[56]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[41], dst[57]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[39], dst[55]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[24], dst[56]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[26], dst[58]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[25], dst[57]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[23], dst[55]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+}
+
+#define BITONIC_SORT_60          SORT_MAKE_STR(bitonic_sort_60)
+static __inline void BITONIC_SORT_60(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[58], dst[59]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[53], dst[55]);
+  SORT_CSWAP(dst[57], dst[59]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[56], dst[58]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[51], dst[55]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[51], dst[56]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[55], dst[58]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[42], dst[58]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[43], dst[59]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[40], dst[56]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[41], dst[57]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[39], dst[55]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[24], dst[56]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[26], dst[58]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[25], dst[57]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[27], dst[59]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[23], dst[55]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+}
+
+#define BITONIC_SORT_61          SORT_MAKE_STR(bitonic_sort_61)
+static __inline void BITONIC_SORT_61(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[49], dst[55]);
+  SORT_CSWAP(dst[57], dst[59]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[56]);
+  SORT_CSWAP(dst[48], dst[60]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[56], dst[59]);
+  SORT_CSWAP(dst[55], dst[60]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[51], dst[55]);
+  SORT_CSWAP(dst[58], dst[59]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[54], dst[60]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[52], dst[57]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[58], dst[59]);
+  SORT_CSWAP(dst[49], dst[55]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[57], dst[59]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[52], dst[55]);
+  SORT_CSWAP(dst[56], dst[58]);
+  SORT_CSWAP(dst[48], dst[53]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[50], dst[53]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[44], dst[60]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[42], dst[58]);
+  SORT_CSWAP(dst[43], dst[59]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[40], dst[56]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[41], dst[57]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[39], dst[55]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[24], dst[56]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[28], dst[60]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[26], dst[58]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[25], dst[57]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[27], dst[59]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[23], dst[55]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+}
+
+#define BITONIC_SORT_62          SORT_MAKE_STR(bitonic_sort_62)
+static __inline void BITONIC_SORT_62(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[58], dst[59]);
+  SORT_CSWAP(dst[60], dst[61]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[56], dst[58]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[53], dst[55]);
+  SORT_CSWAP(dst[57], dst[59]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[56], dst[60]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[57], dst[61]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[51], dst[55]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[48], dst[56]);
+  SORT_CSWAP(dst[49], dst[57]);
+  SORT_CSWAP(dst[50], dst[58]);
+  SORT_CSWAP(dst[51], dst[59]);
+  SORT_CSWAP(dst[52], dst[60]);
+  SORT_CSWAP(dst[53], dst[61]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[53], dst[58]);
+  SORT_CSWAP(dst[54], dst[57]);
+  SORT_CSWAP(dst[51], dst[60]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[55], dst[61]);
+  SORT_CSWAP(dst[50], dst[56]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[59], dst[61]);
+  SORT_CSWAP(dst[51], dst[56]);
+  SORT_CSWAP(dst[55], dst[60]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[45], dst[61]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[44], dst[60]);
+  SORT_CSWAP(dst[42], dst[58]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[43], dst[59]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[40], dst[56]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[41], dst[57]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[39], dst[55]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[59], dst[61]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[24], dst[56]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[28], dst[60]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[26], dst[58]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[25], dst[57]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[29], dst[61]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[27], dst[59]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[23], dst[55]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[59], dst[61]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+}
+
+#define BITONIC_SORT_63          SORT_MAKE_STR(bitonic_sort_63)
+static __inline void BITONIC_SORT_63(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[58], dst[59]);
+  SORT_CSWAP(dst[60], dst[61]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[56], dst[58]);
+  SORT_CSWAP(dst[60], dst[62]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[53], dst[55]);
+  SORT_CSWAP(dst[57], dst[59]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[56], dst[60]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[57], dst[61]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[58], dst[62]);
+  SORT_CSWAP(dst[51], dst[55]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[48], dst[56]);
+  SORT_CSWAP(dst[49], dst[57]);
+  SORT_CSWAP(dst[50], dst[58]);
+  SORT_CSWAP(dst[51], dst[59]);
+  SORT_CSWAP(dst[52], dst[60]);
+  SORT_CSWAP(dst[53], dst[61]);
+  SORT_CSWAP(dst[54], dst[62]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[53], dst[58]);
+  SORT_CSWAP(dst[54], dst[57]);
+  SORT_CSWAP(dst[51], dst[60]);
+  SORT_CSWAP(dst[61], dst[62]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[55], dst[61]);
+  SORT_CSWAP(dst[50], dst[56]);
+  SORT_CSWAP(dst[59], dst[62]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[59], dst[61]);
+  SORT_CSWAP(dst[51], dst[56]);
+  SORT_CSWAP(dst[55], dst[60]);
+  SORT_CSWAP(dst[46], dst[62]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[45], dst[61]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[44], dst[60]);
+  SORT_CSWAP(dst[42], dst[58]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[43], dst[59]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[40], dst[56]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[41], dst[57]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[39], dst[55]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[59], dst[61]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[61], dst[62]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[24], dst[56]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[28], dst[60]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[26], dst[58]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[30], dst[62]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[25], dst[57]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[29], dst[61]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[27], dst[59]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[23], dst[55]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[59], dst[61]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[61], dst[62]);
+}
+
+#define BITONIC_SORT_64          SORT_MAKE_STR(bitonic_sort_64)
+static __inline void BITONIC_SORT_64(SORT_TYPE *dst) {
+  SORT_CSWAP(dst[0], dst[1]);
+  SORT_CSWAP(dst[2], dst[3]);
+  SORT_CSWAP(dst[4], dst[5]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[10], dst[11]);
+  SORT_CSWAP(dst[12], dst[13]);
+  SORT_CSWAP(dst[14], dst[15]);
+  SORT_CSWAP(dst[16], dst[17]);
+  SORT_CSWAP(dst[18], dst[19]);
+  SORT_CSWAP(dst[20], dst[21]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[26], dst[27]);
+  SORT_CSWAP(dst[28], dst[29]);
+  SORT_CSWAP(dst[30], dst[31]);
+  SORT_CSWAP(dst[32], dst[33]);
+  SORT_CSWAP(dst[34], dst[35]);
+  SORT_CSWAP(dst[36], dst[37]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[42], dst[43]);
+  SORT_CSWAP(dst[44], dst[45]);
+  SORT_CSWAP(dst[46], dst[47]);
+  SORT_CSWAP(dst[48], dst[49]);
+  SORT_CSWAP(dst[50], dst[51]);
+  SORT_CSWAP(dst[52], dst[53]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[58], dst[59]);
+  SORT_CSWAP(dst[60], dst[61]);
+  SORT_CSWAP(dst[62], dst[63]);
+  SORT_CSWAP(dst[0], dst[2]);
+  SORT_CSWAP(dst[4], dst[6]);
+  SORT_CSWAP(dst[8], dst[10]);
+  SORT_CSWAP(dst[12], dst[14]);
+  SORT_CSWAP(dst[1], dst[3]);
+  SORT_CSWAP(dst[5], dst[7]);
+  SORT_CSWAP(dst[9], dst[11]);
+  SORT_CSWAP(dst[13], dst[15]);
+  SORT_CSWAP(dst[16], dst[18]);
+  SORT_CSWAP(dst[20], dst[22]);
+  SORT_CSWAP(dst[24], dst[26]);
+  SORT_CSWAP(dst[28], dst[30]);
+  SORT_CSWAP(dst[17], dst[19]);
+  SORT_CSWAP(dst[21], dst[23]);
+  SORT_CSWAP(dst[25], dst[27]);
+  SORT_CSWAP(dst[29], dst[31]);
+  SORT_CSWAP(dst[32], dst[34]);
+  SORT_CSWAP(dst[36], dst[38]);
+  SORT_CSWAP(dst[40], dst[42]);
+  SORT_CSWAP(dst[44], dst[46]);
+  SORT_CSWAP(dst[33], dst[35]);
+  SORT_CSWAP(dst[37], dst[39]);
+  SORT_CSWAP(dst[41], dst[43]);
+  SORT_CSWAP(dst[45], dst[47]);
+  SORT_CSWAP(dst[48], dst[50]);
+  SORT_CSWAP(dst[52], dst[54]);
+  SORT_CSWAP(dst[56], dst[58]);
+  SORT_CSWAP(dst[60], dst[62]);
+  SORT_CSWAP(dst[49], dst[51]);
+  SORT_CSWAP(dst[53], dst[55]);
+  SORT_CSWAP(dst[57], dst[59]);
+  SORT_CSWAP(dst[61], dst[63]);
+  SORT_CSWAP(dst[0], dst[4]);
+  SORT_CSWAP(dst[8], dst[12]);
+  SORT_CSWAP(dst[1], dst[5]);
+  SORT_CSWAP(dst[9], dst[13]);
+  SORT_CSWAP(dst[2], dst[6]);
+  SORT_CSWAP(dst[10], dst[14]);
+  SORT_CSWAP(dst[3], dst[7]);
+  SORT_CSWAP(dst[11], dst[15]);
+  SORT_CSWAP(dst[16], dst[20]);
+  SORT_CSWAP(dst[24], dst[28]);
+  SORT_CSWAP(dst[17], dst[21]);
+  SORT_CSWAP(dst[25], dst[29]);
+  SORT_CSWAP(dst[18], dst[22]);
+  SORT_CSWAP(dst[26], dst[30]);
+  SORT_CSWAP(dst[19], dst[23]);
+  SORT_CSWAP(dst[27], dst[31]);
+  SORT_CSWAP(dst[32], dst[36]);
+  SORT_CSWAP(dst[40], dst[44]);
+  SORT_CSWAP(dst[33], dst[37]);
+  SORT_CSWAP(dst[41], dst[45]);
+  SORT_CSWAP(dst[34], dst[38]);
+  SORT_CSWAP(dst[42], dst[46]);
+  SORT_CSWAP(dst[35], dst[39]);
+  SORT_CSWAP(dst[43], dst[47]);
+  SORT_CSWAP(dst[48], dst[52]);
+  SORT_CSWAP(dst[56], dst[60]);
+  SORT_CSWAP(dst[49], dst[53]);
+  SORT_CSWAP(dst[57], dst[61]);
+  SORT_CSWAP(dst[50], dst[54]);
+  SORT_CSWAP(dst[58], dst[62]);
+  SORT_CSWAP(dst[51], dst[55]);
+  SORT_CSWAP(dst[59], dst[63]);
+  SORT_CSWAP(dst[0], dst[8]);
+  SORT_CSWAP(dst[1], dst[9]);
+  SORT_CSWAP(dst[2], dst[10]);
+  SORT_CSWAP(dst[3], dst[11]);
+  SORT_CSWAP(dst[4], dst[12]);
+  SORT_CSWAP(dst[5], dst[13]);
+  SORT_CSWAP(dst[6], dst[14]);
+  SORT_CSWAP(dst[7], dst[15]);
+  SORT_CSWAP(dst[16], dst[24]);
+  SORT_CSWAP(dst[17], dst[25]);
+  SORT_CSWAP(dst[18], dst[26]);
+  SORT_CSWAP(dst[19], dst[27]);
+  SORT_CSWAP(dst[20], dst[28]);
+  SORT_CSWAP(dst[21], dst[29]);
+  SORT_CSWAP(dst[22], dst[30]);
+  SORT_CSWAP(dst[23], dst[31]);
+  SORT_CSWAP(dst[32], dst[40]);
+  SORT_CSWAP(dst[33], dst[41]);
+  SORT_CSWAP(dst[34], dst[42]);
+  SORT_CSWAP(dst[35], dst[43]);
+  SORT_CSWAP(dst[36], dst[44]);
+  SORT_CSWAP(dst[37], dst[45]);
+  SORT_CSWAP(dst[38], dst[46]);
+  SORT_CSWAP(dst[39], dst[47]);
+  SORT_CSWAP(dst[48], dst[56]);
+  SORT_CSWAP(dst[49], dst[57]);
+  SORT_CSWAP(dst[50], dst[58]);
+  SORT_CSWAP(dst[51], dst[59]);
+  SORT_CSWAP(dst[52], dst[60]);
+  SORT_CSWAP(dst[53], dst[61]);
+  SORT_CSWAP(dst[54], dst[62]);
+  SORT_CSWAP(dst[55], dst[63]);
+  SORT_CSWAP(dst[5], dst[10]);
+  SORT_CSWAP(dst[6], dst[9]);
+  SORT_CSWAP(dst[3], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[21], dst[26]);
+  SORT_CSWAP(dst[22], dst[25]);
+  SORT_CSWAP(dst[19], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[0], dst[16]);
+  SORT_CSWAP(dst[15], dst[31]);
+  SORT_CSWAP(dst[37], dst[42]);
+  SORT_CSWAP(dst[38], dst[41]);
+  SORT_CSWAP(dst[35], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[53], dst[58]);
+  SORT_CSWAP(dst[54], dst[57]);
+  SORT_CSWAP(dst[51], dst[60]);
+  SORT_CSWAP(dst[61], dst[62]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[32], dst[48]);
+  SORT_CSWAP(dst[47], dst[63]);
+  SORT_CSWAP(dst[1], dst[4]);
+  SORT_CSWAP(dst[7], dst[13]);
+  SORT_CSWAP(dst[2], dst[8]);
+  SORT_CSWAP(dst[11], dst[14]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[17], dst[20]);
+  SORT_CSWAP(dst[23], dst[29]);
+  SORT_CSWAP(dst[18], dst[24]);
+  SORT_CSWAP(dst[27], dst[30]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[33], dst[36]);
+  SORT_CSWAP(dst[39], dst[45]);
+  SORT_CSWAP(dst[34], dst[40]);
+  SORT_CSWAP(dst[43], dst[46]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[49], dst[52]);
+  SORT_CSWAP(dst[55], dst[61]);
+  SORT_CSWAP(dst[50], dst[56]);
+  SORT_CSWAP(dst[59], dst[62]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[0], dst[32]);
+  SORT_CSWAP(dst[31], dst[63]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[3], dst[8]);
+  SORT_CSWAP(dst[7], dst[12]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[19], dst[24]);
+  SORT_CSWAP(dst[23], dst[28]);
+  SORT_CSWAP(dst[14], dst[30]);
+  SORT_CSWAP(dst[1], dst[17]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[35], dst[40]);
+  SORT_CSWAP(dst[39], dst[44]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[59], dst[61]);
+  SORT_CSWAP(dst[51], dst[56]);
+  SORT_CSWAP(dst[55], dst[60]);
+  SORT_CSWAP(dst[46], dst[62]);
+  SORT_CSWAP(dst[33], dst[49]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[2], dst[18]);
+  SORT_CSWAP(dst[13], dst[29]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[34], dst[50]);
+  SORT_CSWAP(dst[45], dst[61]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[6], dst[7]);
+  SORT_CSWAP(dst[8], dst[9]);
+  SORT_CSWAP(dst[22], dst[23]);
+  SORT_CSWAP(dst[24], dst[25]);
+  SORT_CSWAP(dst[4], dst[20]);
+  SORT_CSWAP(dst[12], dst[28]);
+  SORT_CSWAP(dst[10], dst[26]);
+  SORT_CSWAP(dst[5], dst[21]);
+  SORT_CSWAP(dst[3], dst[19]);
+  SORT_CSWAP(dst[11], dst[27]);
+  SORT_CSWAP(dst[38], dst[39]);
+  SORT_CSWAP(dst[40], dst[41]);
+  SORT_CSWAP(dst[54], dst[55]);
+  SORT_CSWAP(dst[56], dst[57]);
+  SORT_CSWAP(dst[36], dst[52]);
+  SORT_CSWAP(dst[44], dst[60]);
+  SORT_CSWAP(dst[42], dst[58]);
+  SORT_CSWAP(dst[37], dst[53]);
+  SORT_CSWAP(dst[35], dst[51]);
+  SORT_CSWAP(dst[43], dst[59]);
+  SORT_CSWAP(dst[8], dst[24]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[6], dst[22]);
+  SORT_CSWAP(dst[9], dst[25]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[7], dst[23]);
+  SORT_CSWAP(dst[40], dst[56]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[38], dst[54]);
+  SORT_CSWAP(dst[41], dst[57]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[39], dst[55]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[59], dst[61]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[61], dst[62]);
+  SORT_CSWAP(dst[16], dst[48]);
+  SORT_CSWAP(dst[8], dst[40]);
+  SORT_CSWAP(dst[24], dst[56]);
+  SORT_CSWAP(dst[4], dst[36]);
+  SORT_CSWAP(dst[20], dst[52]);
+  SORT_CSWAP(dst[12], dst[44]);
+  SORT_CSWAP(dst[28], dst[60]);
+  SORT_CSWAP(dst[2], dst[34]);
+  SORT_CSWAP(dst[18], dst[50]);
+  SORT_CSWAP(dst[10], dst[42]);
+  SORT_CSWAP(dst[26], dst[58]);
+  SORT_CSWAP(dst[6], dst[38]);
+  SORT_CSWAP(dst[22], dst[54]);
+  SORT_CSWAP(dst[14], dst[46]);
+  SORT_CSWAP(dst[30], dst[62]);
+  SORT_CSWAP(dst[1], dst[33]);
+  SORT_CSWAP(dst[17], dst[49]);
+  SORT_CSWAP(dst[9], dst[41]);
+  SORT_CSWAP(dst[25], dst[57]);
+  SORT_CSWAP(dst[5], dst[37]);
+  SORT_CSWAP(dst[21], dst[53]);
+  SORT_CSWAP(dst[13], dst[45]);
+  SORT_CSWAP(dst[29], dst[61]);
+  SORT_CSWAP(dst[3], dst[35]);
+  SORT_CSWAP(dst[19], dst[51]);
+  SORT_CSWAP(dst[11], dst[43]);
+  SORT_CSWAP(dst[27], dst[59]);
+  SORT_CSWAP(dst[7], dst[39]);
+  SORT_CSWAP(dst[23], dst[55]);
+  SORT_CSWAP(dst[15], dst[47]);
+  SORT_CSWAP(dst[16], dst[32]);
+  SORT_CSWAP(dst[24], dst[40]);
+  SORT_CSWAP(dst[20], dst[36]);
+  SORT_CSWAP(dst[28], dst[44]);
+  SORT_CSWAP(dst[18], dst[34]);
+  SORT_CSWAP(dst[26], dst[42]);
+  SORT_CSWAP(dst[22], dst[38]);
+  SORT_CSWAP(dst[30], dst[46]);
+  SORT_CSWAP(dst[17], dst[33]);
+  SORT_CSWAP(dst[25], dst[41]);
+  SORT_CSWAP(dst[21], dst[37]);
+  SORT_CSWAP(dst[29], dst[45]);
+  SORT_CSWAP(dst[19], dst[35]);
+  SORT_CSWAP(dst[27], dst[43]);
+  SORT_CSWAP(dst[23], dst[39]);
+  SORT_CSWAP(dst[31], dst[47]);
+  SORT_CSWAP(dst[8], dst[16]);
+  SORT_CSWAP(dst[24], dst[32]);
+  SORT_CSWAP(dst[40], dst[48]);
+  SORT_CSWAP(dst[12], dst[20]);
+  SORT_CSWAP(dst[28], dst[36]);
+  SORT_CSWAP(dst[44], dst[52]);
+  SORT_CSWAP(dst[10], dst[18]);
+  SORT_CSWAP(dst[26], dst[34]);
+  SORT_CSWAP(dst[42], dst[50]);
+  SORT_CSWAP(dst[14], dst[22]);
+  SORT_CSWAP(dst[30], dst[38]);
+  SORT_CSWAP(dst[46], dst[54]);
+  SORT_CSWAP(dst[9], dst[17]);
+  SORT_CSWAP(dst[25], dst[33]);
+  SORT_CSWAP(dst[41], dst[49]);
+  SORT_CSWAP(dst[13], dst[21]);
+  SORT_CSWAP(dst[29], dst[37]);
+  SORT_CSWAP(dst[45], dst[53]);
+  SORT_CSWAP(dst[11], dst[19]);
+  SORT_CSWAP(dst[27], dst[35]);
+  SORT_CSWAP(dst[43], dst[51]);
+  SORT_CSWAP(dst[15], dst[23]);
+  SORT_CSWAP(dst[31], dst[39]);
+  SORT_CSWAP(dst[47], dst[55]);
+  SORT_CSWAP(dst[4], dst[8]);
+  SORT_CSWAP(dst[12], dst[16]);
+  SORT_CSWAP(dst[20], dst[24]);
+  SORT_CSWAP(dst[28], dst[32]);
+  SORT_CSWAP(dst[36], dst[40]);
+  SORT_CSWAP(dst[44], dst[48]);
+  SORT_CSWAP(dst[52], dst[56]);
+  SORT_CSWAP(dst[6], dst[10]);
+  SORT_CSWAP(dst[14], dst[18]);
+  SORT_CSWAP(dst[22], dst[26]);
+  SORT_CSWAP(dst[30], dst[34]);
+  SORT_CSWAP(dst[38], dst[42]);
+  SORT_CSWAP(dst[46], dst[50]);
+  SORT_CSWAP(dst[54], dst[58]);
+  SORT_CSWAP(dst[5], dst[9]);
+  SORT_CSWAP(dst[13], dst[17]);
+  SORT_CSWAP(dst[21], dst[25]);
+  SORT_CSWAP(dst[29], dst[33]);
+  SORT_CSWAP(dst[37], dst[41]);
+  SORT_CSWAP(dst[45], dst[49]);
+  SORT_CSWAP(dst[53], dst[57]);
+  SORT_CSWAP(dst[7], dst[11]);
+  SORT_CSWAP(dst[15], dst[19]);
+  SORT_CSWAP(dst[23], dst[27]);
+  SORT_CSWAP(dst[31], dst[35]);
+  SORT_CSWAP(dst[39], dst[43]);
+  SORT_CSWAP(dst[47], dst[51]);
+  SORT_CSWAP(dst[55], dst[59]);
+  SORT_CSWAP(dst[2], dst[4]);
+  SORT_CSWAP(dst[6], dst[8]);
+  SORT_CSWAP(dst[10], dst[12]);
+  SORT_CSWAP(dst[14], dst[16]);
+  SORT_CSWAP(dst[18], dst[20]);
+  SORT_CSWAP(dst[22], dst[24]);
+  SORT_CSWAP(dst[26], dst[28]);
+  SORT_CSWAP(dst[30], dst[32]);
+  SORT_CSWAP(dst[34], dst[36]);
+  SORT_CSWAP(dst[38], dst[40]);
+  SORT_CSWAP(dst[42], dst[44]);
+  SORT_CSWAP(dst[46], dst[48]);
+  SORT_CSWAP(dst[50], dst[52]);
+  SORT_CSWAP(dst[54], dst[56]);
+  SORT_CSWAP(dst[58], dst[60]);
+  SORT_CSWAP(dst[3], dst[5]);
+  SORT_CSWAP(dst[7], dst[9]);
+  SORT_CSWAP(dst[11], dst[13]);
+  SORT_CSWAP(dst[15], dst[17]);
+  SORT_CSWAP(dst[19], dst[21]);
+  SORT_CSWAP(dst[23], dst[25]);
+  SORT_CSWAP(dst[27], dst[29]);
+  SORT_CSWAP(dst[31], dst[33]);
+  SORT_CSWAP(dst[35], dst[37]);
+  SORT_CSWAP(dst[39], dst[41]);
+  SORT_CSWAP(dst[43], dst[45]);
+  SORT_CSWAP(dst[47], dst[49]);
+  SORT_CSWAP(dst[51], dst[53]);
+  SORT_CSWAP(dst[55], dst[57]);
+  SORT_CSWAP(dst[59], dst[61]);
+  SORT_CSWAP(dst[1], dst[2]);
+  SORT_CSWAP(dst[3], dst[4]);
+  SORT_CSWAP(dst[5], dst[6]);
+  SORT_CSWAP(dst[7], dst[8]);
+  SORT_CSWAP(dst[9], dst[10]);
+  SORT_CSWAP(dst[11], dst[12]);
+  SORT_CSWAP(dst[13], dst[14]);
+  SORT_CSWAP(dst[15], dst[16]);
+  SORT_CSWAP(dst[17], dst[18]);
+  SORT_CSWAP(dst[19], dst[20]);
+  SORT_CSWAP(dst[21], dst[22]);
+  SORT_CSWAP(dst[23], dst[24]);
+  SORT_CSWAP(dst[25], dst[26]);
+  SORT_CSWAP(dst[27], dst[28]);
+  SORT_CSWAP(dst[29], dst[30]);
+  SORT_CSWAP(dst[31], dst[32]);
+  SORT_CSWAP(dst[33], dst[34]);
+  SORT_CSWAP(dst[35], dst[36]);
+  SORT_CSWAP(dst[37], dst[38]);
+  SORT_CSWAP(dst[39], dst[40]);
+  SORT_CSWAP(dst[41], dst[42]);
+  SORT_CSWAP(dst[43], dst[44]);
+  SORT_CSWAP(dst[45], dst[46]);
+  SORT_CSWAP(dst[47], dst[48]);
+  SORT_CSWAP(dst[49], dst[50]);
+  SORT_CSWAP(dst[51], dst[52]);
+  SORT_CSWAP(dst[53], dst[54]);
+  SORT_CSWAP(dst[55], dst[56]);
+  SORT_CSWAP(dst[57], dst[58]);
+  SORT_CSWAP(dst[59], dst[60]);
+  SORT_CSWAP(dst[61], dst[62]);
+}
+
+/* Sorts dst with one of the networks above, if there is one for its size, and says
+   whether there was. */
+#define BITONIC_SORT_LARGE          SORT_MAKE_STR(bitonic_sort_large)
+static __inline int BITONIC_SORT_LARGE(SORT_TYPE *dst, const size_t size) {
+  switch (size) {
+  case 17:
+    BITONIC_SORT_17(dst);
+    return 1;
+
+  case 18:
+    BITONIC_SORT_18(dst);
+    return 1;
+
+  case 19:
+    BITONIC_SORT_19(dst);
+    return 1;
+
+  case 20:
+    BITONIC_SORT_20(dst);
+    return 1;
+
+  case 21:
+    BITONIC_SORT_21(dst);
+    return 1;
+
+  case 22:
+    BITONIC_SORT_22(dst);
+    return 1;
+
+  case 23:
+    BITONIC_SORT_23(dst);
+    return 1;
+
+  case 24:
+    BITONIC_SORT_24(dst);
+    return 1;
+
+  case 25:
+    BITONIC_SORT_25(dst);
+    return 1;
+
+  case 26:
+    BITONIC_SORT_26(dst);
+    return 1;
+
+  case 27:
+    BITONIC_SORT_27(dst);
+    return 1;
+
+  case 28:
+    BITONIC_SORT_28(dst);
+    return 1;
+
+  case 29:
+    BITONIC_SORT_29(dst);
+    return 1;
+
+  case 30:
+    BITONIC_SORT_30(dst);
+    return 1;
+
+  case 31:
+    BITONIC_SORT_31(dst);
+    return 1;
+
+  case 32:
+    BITONIC_SORT_32(dst);
+    return 1;
+
+  case 33:
+    BITONIC_SORT_33(dst);
+    return 1;
+
+  case 34:
+    BITONIC_SORT_34(dst);
+    return 1;
+
+  case 35:
+    BITONIC_SORT_35(dst);
+    return 1;
+
+  case 36:
+    BITONIC_SORT_36(dst);
+    return 1;
+
+  case 37:
+    BITONIC_SORT_37(dst);
+    return 1;
+
+  case 38:
+    BITONIC_SORT_38(dst);
+    return 1;
+
+  case 39:
+    BITONIC_SORT_39(dst);
+    return 1;
+
+  case 40:
+    BITONIC_SORT_40(dst);
+    return 1;
+
+  case 41:
+    BITONIC_SORT_41(dst);
+    return 1;
+
+  case 42:
+    BITONIC_SORT_42(dst);
+    return 1;
+
+  case 43:
+    BITONIC_SORT_43(dst);
+    return 1;
+
+  case 44:
+    BITONIC_SORT_44(dst);
+    return 1;
+
+  case 45:
+    BITONIC_SORT_45(dst);
+    return 1;
+
+  case 46:
+    BITONIC_SORT_46(dst);
+    return 1;
+
+  case 47:
+    BITONIC_SORT_47(dst);
+    return 1;
+
+  case 48:
+    BITONIC_SORT_48(dst);
+    return 1;
+
+  case 49:
+    BITONIC_SORT_49(dst);
+    return 1;
+
+  case 50:
+    BITONIC_SORT_50(dst);
+    return 1;
+
+  case 51:
+    BITONIC_SORT_51(dst);
+    return 1;
+
+  case 52:
+    BITONIC_SORT_52(dst);
+    return 1;
+
+  case 53:
+    BITONIC_SORT_53(dst);
+    return 1;
+
+  case 54:
+    BITONIC_SORT_54(dst);
+    return 1;
+
+  case 55:
+    BITONIC_SORT_55(dst);
+    return 1;
+
+  case 56:
+    BITONIC_SORT_56(dst);
+    return 1;
+
+  case 57:
+    BITONIC_SORT_57(dst);
+    return 1;
+
+  case 58:
+    BITONIC_SORT_58(dst);
+    return 1;
+
+  case 59:
+    BITONIC_SORT_59(dst);
+    return 1;
+
+  case 60:
+    BITONIC_SORT_60(dst);
+    return 1;
+
+  case 61:
+    BITONIC_SORT_61(dst);
+    return 1;
+
+  case 62:
+    BITONIC_SORT_62(dst);
+    return 1;
+
+  case 63:
+    BITONIC_SORT_63(dst);
+    return 1;
+
+  case 64:
+    BITONIC_SORT_64(dst);
+    return 1;
+
+  default:
+    return 0;
+  }
+}
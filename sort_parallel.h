@@ -0,0 +1,2833 @@
+/* Copyright (c) 2010-2024 Christopher Swenson. */
+/* Copyright (c) 2012 Google Inc. All Rights Reserved. */
+
+/* Parallel sorting routines, included by sort.h when SORT_PARALLEL is defined.
+
+   Everything here runs on a small work-stealing task pool: every worker owns a
+   deque of tasks, pushes and pops its own work at the tail, and when it runs dry
+   steals the oldest task from the head of somebody else's deque.  Every deque has
+   a lock of its own, and a worker with nothing to do sleeps until a push wakes it
+   (one sleeper per task) or what it waits for is done.  The calling thread is
+   worker 0 and helps out while it waits.
+
+   The pool lives in a sort_ctx that can be kept around and reused across calls,
+   and its threads either come from pthreads or, if the host program would rather
+   keep them to itself, from the host's own executor.  Define SORT_THREADS to 0
+   (the default on Windows) and every routine here quietly runs on the calling
+   thread instead. */
+
+#ifndef SORT_PARALLEL_COMMON_H
+#define SORT_PARALLEL_COMMON_H
+
+#ifndef SORT_THREADS
+#ifdef _WIN32
+#define SORT_THREADS 0
+#else
+#define SORT_THREADS 1
+#endif
+#endif
+
+#if SORT_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* Define SORT_NUMA (and link with -lnuma) to let NUMA contexts bind their threads
+   and scratch memory to real nodes through libnuma. */
+#if SORT_THREADS && defined(SORT_NUMA)
+#include <numa.h>
+#endif
+
+/* Ranges smaller than this are never split across threads. */
+#ifndef SORT_PARALLEL_CUTOFF
+#define SORT_PARALLEL_CUTOFF 16384
+#endif
+
+/* Upper bound on how many pieces a single cooperative step is split into. */
+#define SORT_PARALLEL_MAX_CHUNKS 128
+
+/* Fewest gap chains each piece of a parallel shell sort pass gets, so that no
+   two pieces keep writing to the same cache lines of a row. */
+#define SORT_PARALLEL_SHELL_CHAINS 64
+
+typedef struct sort_worker sort_worker;
+typedef struct sort_pool sort_pool;
+
+/* A sort context is a pool that outlives any one call, so repeated sorts don't pay
+   for starting threads every time.  Make one with sort_ctx_create(), pass it to as
+   many parallel sorts as you like (one at a time), and free it with
+   sort_ctx_destroy().  Passing NULL instead gets a pool made for just that call. */
+typedef struct sort_pool sort_ctx;
+
+/* A host executor: submit(executor, job, arg) has to arrange for job(arg) to run on
+   some other thread (not inline), and wait(executor) has to block until every job
+   submitted so far has returned. */
+typedef void (*sort_executor_submit)(void *executor, void (*job)(void *arg), void *arg);
+typedef void (*sort_executor_wait)(void *executor);
+
+typedef struct {
+  int nthreads;          /* workers, counting the caller; <= 0 means one per CPU */
+  int pin_threads;       /* pin worker i to the i-th CPU we may run on, where supported */
+  size_t serial_cutoff;  /* sort this many elements or fewer on the calling thread
+                            without touching the pool; 0 means SORT_PARALLEL_CUTOFF */
+  void *executor;        /* with submit and wait set, the workers run as jobs on the
+                            host's executor for the length of each call, and we start
+                            no threads of our own */
+  sort_executor_submit submit;
+  sort_executor_wait wait;
+  int numa_nodes;        /* split our own workers into this many NUMA nodes, so sorts
+                            that know about nodes keep each node's work and scratch
+                            memory local; < 0 asks libnuma how many there are, 0 or 1
+                            means no NUMA awareness.  More nodes than the machine has
+                            are only simulated, which is handy for testing. */
+} sort_ctx_options;
+
+/* A task works on [begin, end) of whatever data points at. */
+typedef void (*sort_task_fn)(sort_worker *w, void *data, size_t begin, size_t end);
+
+/* Fork-join counter: sort_group_wait() returns once every task spawned into the
+   group has finished.  pending only moves by atomic adds, so finishing a task takes
+   no lock unless it is the last one, which wakes waiter, the worker that waits. */
+typedef struct {
+  size_t pending;
+  sort_worker *waiter;
+} sort_group;
+
+typedef struct {
+  sort_task_fn fn;
+  void *data;
+  size_t begin;
+  size_t end;
+  sort_group *group;
+  int node; /* only workers on this node may run it, or -1 for anybody */
+} sort_task;
+
+struct sort_worker {
+  sort_pool *pool;
+  int id;
+  int node;         /* NUMA node this worker belongs to */
+  int node_threads; /* how many workers that node has */
+  int bound;        /* node the running task is tied to, or -1 */
+  int sleeping;     /* waiting to be woken; only touched with the pool lock held */
+  sort_task *tasks;
+  size_t head; /* oldest task, taken by thieves */
+  size_t tail; /* one past the newest task, pushed and popped by the owner */
+  size_t alloc;
+#if SORT_THREADS
+  pthread_mutex_t lock; /* guards tasks, head, tail and alloc */
+  pthread_cond_t wake;  /* signalled with the pool lock held */
+#endif
+};
+
+struct sort_pool {
+  int nthreads;
+  int shutdown;
+  int running;   /* a call is in progress; executor jobs leave once it is over */
+  int temporary; /* made for a single call, destroyed at the end of it */
+  int nodes;     /* NUMA nodes the workers are split into */
+  int numa;      /* nodes are real and libnuma places threads and memory on them */
+  size_t idle;   /* workers asleep; pushes read it without the lock */
+  size_t serial_cutoff;
+  void *executor;
+  sort_executor_submit submit;
+  sort_executor_wait wait;
+  sort_worker *workers;
+#if SORT_THREADS
+  pthread_t *threads;
+  pthread_mutex_t lock; /* guards sleeping, shutdown and running */
+#endif
+};
+
+/* The pool lock is only taken to go to sleep and to wake somebody up; the deques
+   have a lock each. */
+#if SORT_THREADS
+#define SORT_POOL_LOCK(pool)     pthread_mutex_lock(&(pool)->lock)
+#define SORT_POOL_UNLOCK(pool)   pthread_mutex_unlock(&(pool)->lock)
+#define SORT_DEQUE_LOCK(w)       pthread_mutex_lock(&(w)->lock)
+#define SORT_DEQUE_UNLOCK(w)     pthread_mutex_unlock(&(w)->lock)
+#define SORT_WORKER_INIT(w)      (pthread_mutex_init(&(w)->lock, NULL), \
+                                  pthread_cond_init(&(w)->wake, NULL))
+#define SORT_WORKER_DESTROY(w)   (pthread_mutex_destroy(&(w)->lock), \
+                                  pthread_cond_destroy(&(w)->wake))
+#define SORT_WORKER_WAIT(w)      pthread_cond_wait(&(w)->wake, &(w)->pool->lock)
+#define SORT_WORKER_SIGNAL(w)    pthread_cond_signal(&(w)->wake)
+#else
+#define SORT_POOL_LOCK(pool)
+#define SORT_POOL_UNLOCK(pool)
+#define SORT_DEQUE_LOCK(w)
+#define SORT_DEQUE_UNLOCK(w)
+#define SORT_WORKER_INIT(w)      ((void)(w))
+#define SORT_WORKER_DESTROY(w)   ((void)(w))
+#define SORT_WORKER_WAIT(w)
+#define SORT_WORKER_SIGNAL(w)
+#endif
+
+/* Atomic adds on a size_t, with the compiler's builtins where it has them and
+   otherwise under a lock of their own; both return the new value. */
+#if SORT_THREADS && defined(__ATOMIC_ACQ_REL)
+#define SORT_ATOMIC_ADD(p, v) __atomic_add_fetch((p), (v), __ATOMIC_ACQ_REL)
+#define SORT_ATOMIC_SUB(p, v) __atomic_sub_fetch((p), (v), __ATOMIC_ACQ_REL)
+#define SORT_ATOMIC_LOAD(p)   __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#elif SORT_THREADS
+static pthread_mutex_t sort_atomic_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static size_t sort_atomic_add(size_t *p, const size_t v) {
+  size_t result;
+  pthread_mutex_lock(&sort_atomic_lock);
+  result = *p += v;
+  pthread_mutex_unlock(&sort_atomic_lock);
+  return result;
+}
+
+#define SORT_ATOMIC_ADD(p, v) sort_atomic_add((p), (v))
+#define SORT_ATOMIC_SUB(p, v) sort_atomic_add((p), (size_t)0 - (v))
+#define SORT_ATOMIC_LOAD(p)   sort_atomic_add((p), 0)
+#else
+#define SORT_ATOMIC_ADD(p, v) (*(p) += (v))
+#define SORT_ATOMIC_SUB(p, v) (*(p) -= (v))
+#define SORT_ATOMIC_LOAD(p)   (*(p))
+#endif
+
+/* A lock of its own for one piece of shared state inside a sort, such as a bucket,
+   so threads working on different pieces don't wait on each other or on the pool. */
+#if SORT_THREADS
+typedef struct {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+} sort_lock;
+
+#define SORT_LOCK_INIT(l)    (pthread_mutex_init(&(l)->mutex, NULL), \
+                              pthread_cond_init(&(l)->cond, NULL))
+#define SORT_LOCK_DESTROY(l) (pthread_mutex_destroy(&(l)->mutex), \
+                              pthread_cond_destroy(&(l)->cond))
+#define SORT_LOCK(l)         pthread_mutex_lock(&(l)->mutex)
+#define SORT_UNLOCK(l)       pthread_mutex_unlock(&(l)->mutex)
+#define SORT_LOCK_WAIT(l)    pthread_cond_wait(&(l)->cond, &(l)->mutex)
+#define SORT_LOCK_WAKE(l)    pthread_cond_broadcast(&(l)->cond)
+#else
+typedef struct {
+  int unused;
+} sort_lock;
+
+#define SORT_LOCK_INIT(l)    ((void)(l))
+#define SORT_LOCK_DESTROY(l) ((void)(l))
+#define SORT_LOCK(l)
+#define SORT_UNLOCK(l)
+#define SORT_LOCK_WAIT(l)
+#define SORT_LOCK_WAKE(l)
+#endif
+
+static int sort_cpu_count(void) {
+#if SORT_THREADS && defined(_SC_NPROCESSORS_ONLN)
+  const long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+  if (n > 0) {
+    return (int)n;
+  }
+
+#endif
+  return 1;
+}
+
+/* Take a task to run: our own newest first, otherwise steal somebody else's oldest. */
+static int sort_pool_take(sort_worker *w, sort_task *task) {
+  sort_pool *pool = w->pool;
+  int found = 0;
+  int i;
+  SORT_DEQUE_LOCK(w);
+
+  if (w->tail > w->head) {
+    *task = w->tasks[--w->tail];
+    found = 1;
+  }
+
+  SORT_DEQUE_UNLOCK(w);
+
+  for (i = 1; !found && (i < pool->nthreads); i++) {
+    sort_worker *victim = &pool->workers[(w->id + i) % pool->nthreads];
+    SORT_DEQUE_LOCK(victim);
+
+    /* leave tasks tied to other nodes for their own workers */
+    if ((victim->tail > victim->head) &&
+        ((victim->tasks[victim->head].node < 0) || (victim->tasks[victim->head].node == w->node))) {
+      *task = victim->tasks[victim->head++];
+      found = 1;
+    }
+
+    SORT_DEQUE_UNLOCK(victim);
+  }
+
+  return found;
+}
+
+/* Wake w if it is asleep.  Must be called with the pool lock held. */
+static void sort_pool_wake(sort_pool *pool, sort_worker *w) {
+  if (w->sleeping) {
+    w->sleeping = 0;
+    SORT_ATOMIC_SUB(&pool->idle, 1);
+    SORT_WORKER_SIGNAL(w);
+  }
+}
+
+/* Wake one sleeping worker that may run a task tied to node (or -1), if there is
+   one.  Whoever went to sleep counted itself idle before its last look at our
+   deque, so a task pushed after that look always sees it here. */
+static void sort_pool_wake_one(sort_pool *pool, const int node) {
+  int i;
+
+  if (SORT_ATOMIC_LOAD(&pool->idle) == 0) {
+    return;
+  }
+
+  SORT_POOL_LOCK(pool);
+
+  for (i = 0; i < pool->nthreads; i++) {
+    if (pool->workers[i].sleeping && ((node < 0) || (pool->workers[i].node == node))) {
+      sort_pool_wake(pool, &pool->workers[i]);
+      break;
+    }
+  }
+
+  SORT_POOL_UNLOCK(pool);
+}
+
+/* Whether w can stop waiting: group is done, or with no group, the pool is shutting
+   down or the executor call is over.  Must be called with the pool lock held. */
+static __inline int sort_pool_done(const sort_pool *pool, sort_group *group) {
+  if (group != NULL) {
+    return SORT_ATOMIC_LOAD(&group->pending) == 0;
+  }
+
+  return pool->shutdown || ((pool->submit != NULL) && !pool->running);
+}
+
+/* Sleep until woken, unless a task turns up in the meantime (it is put in task and 1
+   returned) or sort_pool_done() says there is no need. */
+static int sort_pool_sleep(sort_worker *w, sort_group *group, sort_task *task) {
+  sort_pool *pool = w->pool;
+  int found;
+  SORT_POOL_LOCK(pool);
+  w->sleeping = 1;
+  SORT_ATOMIC_ADD(&pool->idle, 1);
+  /* one last look, now that pushes know we are about to sleep */
+  found = sort_pool_take(w, task);
+
+  if (!found && !sort_pool_done(pool, group)) {
+    while (w->sleeping) {
+      SORT_WORKER_WAIT(w);
+    }
+  }
+
+  if (w->sleeping) {
+    w->sleeping = 0;
+    SORT_ATOMIC_SUB(&pool->idle, 1);
+  }
+
+  SORT_POOL_UNLOCK(pool);
+  return found;
+}
+
+static void sort_task_run(sort_worker *w, sort_task *task) {
+  sort_group *group = task->group;
+  /* the group may be gone as soon as pending reaches zero */
+  sort_worker *waiter = group->waiter;
+  const int bound = w->bound;
+  w->bound = task->node;
+  task->fn(w, task->data, task->begin, task->end);
+  w->bound = bound;
+
+  if (SORT_ATOMIC_SUB(&group->pending, 1) == 0) {
+    SORT_POOL_LOCK(w->pool);
+    sort_pool_wake(w->pool, waiter);
+    SORT_POOL_UNLOCK(w->pool);
+  }
+}
+
+/* A new group, waited for by w. */
+static __inline void sort_group_init(sort_worker *w, sort_group *group) {
+  group->pending = 0;
+  group->waiter = w;
+}
+
+/* Queue fn(data, begin, end) on owner's deque as part of group, tied to node (or
+   -1); runs it immediately when there is nobody to share it with. */
+static void sort_push(sort_worker *w, sort_worker *owner, const int node, sort_group *group,
+                      sort_task_fn fn, void *data, const size_t begin, const size_t end) {
+  sort_pool *pool = w->pool;
+  sort_task *task;
+
+  if (pool->nthreads <= 1) {
+    fn(w, data, begin, end);
+    return;
+  }
+
+  SORT_DEQUE_LOCK(owner);
+
+  if (owner->tail == owner->alloc) {
+    /* slide the live tasks down, or grow the deque */
+    if (owner->head > 0) {
+      memmove(owner->tasks, owner->tasks + owner->head,
+              (owner->tail - owner->head) * sizeof(sort_task));
+      owner->tail -= owner->head;
+      owner->head = 0;
+    } else {
+      const size_t alloc = owner->alloc ? 2 * owner->alloc : 64;
+      sort_task *tasks = (sort_task *)realloc(owner->tasks, alloc * sizeof(sort_task));
+
+      if (tasks == NULL) {
+        SORT_DEQUE_UNLOCK(owner);
+        fn(w, data, begin, end);
+        return;
+      }
+
+      owner->tasks = tasks;
+      owner->alloc = alloc;
+    }
+  }
+
+  task = &owner->tasks[owner->tail++];
+  task->fn = fn;
+  task->data = data;
+  task->begin = begin;
+  task->end = end;
+  task->group = group;
+  task->node = node;
+  SORT_ATOMIC_ADD(&group->pending, 1);
+  SORT_DEQUE_UNLOCK(owner);
+  sort_pool_wake_one(pool, node);
+}
+
+/* Spawned tasks stay on the node of the task that spawned them. */
+static __inline void sort_spawn(sort_worker *w, sort_group *group, sort_task_fn fn, void *data,
+                                const size_t begin, const size_t end) {
+  sort_push(w, w, w->bound, group, fn, data, begin, end);
+}
+
+/* The first worker of a node: node j has workers [first(j), first(j + 1)). */
+static __inline int sort_node_first(const sort_pool *pool, const int node) {
+  return (node * pool->nthreads + pool->nodes - 1) / pool->nodes;
+}
+
+/* Queue a task that only node's workers may run. */
+static __inline void sort_spawn_on(sort_worker *w, const int node, sort_group *group,
+                                   sort_task_fn fn, void *data, const size_t begin,
+                                   const size_t end) {
+  sort_push(w, &w->pool->workers[sort_node_first(w->pool, node)], node, group, fn, data, begin,
+            end);
+}
+
+/* Wait for everything spawned into group, running queued tasks in the meantime. */
+static void sort_group_wait(sort_worker *w, sort_group *group) {
+  sort_task task;
+
+  while (SORT_ATOMIC_LOAD(&group->pending) > 0) {
+    if (sort_pool_take(w, &task) || sort_pool_sleep(w, group, &task)) {
+      sort_task_run(w, &task);
+    }
+  }
+}
+
+/* Run fn(data, i, count) for every i in [0, count) and wait for all of them. */
+static void sort_parallel_for(sort_worker *w, sort_task_fn fn, void *data, const size_t count) {
+  sort_group group;
+  size_t i;
+  sort_group_init(w, &group);
+
+  for (i = 1; i < count; i++) {
+    sort_spawn(w, &group, fn, data, i, count);
+  }
+
+  if (count > 0) {
+    fn(w, data, 0, count);
+  }
+
+  sort_group_wait(w, &group);
+}
+
+#if SORT_THREADS
+/* Run tasks until the pool shuts down, or for an executor job, until the current
+   call is over. */
+static void sort_worker_loop(sort_worker *w) {
+  sort_pool *pool = w->pool;
+  sort_task task;
+  int done;
+
+  while (1) {
+    if (sort_pool_take(w, &task) || sort_pool_sleep(w, NULL, &task)) {
+      sort_task_run(w, &task);
+      continue;
+    }
+
+    SORT_POOL_LOCK(pool);
+    done = sort_pool_done(pool, NULL);
+    SORT_POOL_UNLOCK(pool);
+
+    if (done) {
+      break;
+    }
+  }
+}
+
+static void *sort_worker_main(void *arg) {
+  sort_worker *w = (sort_worker *)arg;
+  int node;
+  /* sort_ctx_create() holds the lock until it knows how many of us there are */
+  SORT_POOL_LOCK(w->pool);
+  node = w->pool->numa ? w->node : -1;
+  SORT_POOL_UNLOCK(w->pool);
+#ifdef SORT_NUMA
+
+  if (node >= 0) {
+    numa_run_on_node(node);
+  }
+
+#else
+  (void)node;
+#endif
+  sort_worker_loop(w);
+  return NULL;
+}
+
+static void sort_worker_job(void *arg) {
+  sort_worker_loop((sort_worker *)arg);
+}
+
+/* Pin thread to the n-th CPU this process may run on.  Only where the affinity
+   extensions are visible (glibc with _GNU_SOURCE); elsewhere it does nothing. */
+static void sort_pin_thread(pthread_t thread, int n) {
+#if defined(CPU_SET) && defined(__linux__)
+  cpu_set_t allowed, one;
+  int cpu;
+
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    return;
+  }
+
+  n %= CPU_COUNT(&allowed);
+
+  for (cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &allowed) && (n-- == 0)) {
+      CPU_ZERO(&one);
+      CPU_SET(cpu, &one);
+      pthread_setaffinity_np(thread, sizeof(one), &one);
+      return;
+    }
+  }
+
+#else
+  (void)thread;
+  (void)n;
+#endif
+}
+#endif
+
+#if SORT_THREADS
+/* Split the workers into (at most) nodes NUMA nodes of consecutive workers. */
+static void sort_ctx_split_nodes(sort_pool *pool, int nodes) {
+  int i;
+#ifdef SORT_NUMA
+  const int real = (numa_available() >= 0) ? numa_num_configured_nodes() : 1;
+
+  if (nodes < 0) {
+    nodes = real;
+  }
+
+  pool->numa = (nodes > 1) && (nodes <= real) && (nodes <= pool->nthreads);
+#else
+
+  /* nothing to ask, so no NUMA awareness unless asked for by number */
+  if (nodes < 0) {
+    nodes = 1;
+  }
+
+#endif
+  pool->nodes = MAX(MIN(nodes, pool->nthreads), 1);
+
+  for (i = 0; i < pool->nthreads; i++) {
+    pool->workers[i].node = (int)((long)i * pool->nodes / pool->nthreads);
+  }
+
+  for (i = 0; i < pool->nthreads; i++) {
+    const int node = pool->workers[i].node;
+    pool->workers[i].node_threads = sort_node_first(pool, node + 1) - sort_node_first(pool, node);
+  }
+}
+#endif
+
+/* Put each node's share of memory (size elements of elem bytes) on that node; they
+   still go wherever they are first touched when this isn't a real NUMA context. */
+static void sort_ctx_place(const sort_pool *pool, void *memory, const size_t size,
+                           const size_t elem) {
+#ifdef SORT_NUMA
+  const size_t page = (size_t)numa_pagesize();
+  int node;
+
+  if (!pool->numa) {
+    return;
+  }
+
+  for (node = 0; node < pool->nodes; node++) {
+    char *begin = (char *)memory + (size_t)node * size / (size_t)pool->nodes * elem;
+    char *end = (char *)memory + (size_t)(node + 1) * size / (size_t)pool->nodes * elem;
+    /* only the whole pages inside the node's share */
+    begin += (page - (size_t)begin % page) % page;
+    end -= (size_t)end % page;
+
+    if (end > begin) {
+      numa_tonode_memory(begin, (size_t)(end - begin), node);
+    }
+  }
+
+#else
+  (void)pool;
+  (void)memory;
+  (void)size;
+  (void)elem;
+#endif
+}
+
+/* Make a context (options may be NULL for the defaults); the caller is worker 0. */
+static sort_ctx *sort_ctx_create(const sort_ctx_options *options) {
+  sort_pool *pool;
+  int nthreads = (options != NULL) ? options->nthreads : 0;
+  int i;
+
+  if (nthreads <= 0) {
+    nthreads = sort_cpu_count();
+  }
+
+#if !SORT_THREADS
+  nthreads = 1;
+#endif
+  pool = (sort_pool *)calloc(1, sizeof(sort_pool));
+
+  if (pool != NULL) {
+    pool->workers = (sort_worker *)calloc((size_t)nthreads, sizeof(sort_worker));
+  }
+
+  if ((pool == NULL) || (pool->workers == NULL)) {
+    fprintf(stderr, "Error allocating thread pool for %d threads", nthreads);
+    exit(1);
+  }
+
+  pool->serial_cutoff = SORT_PARALLEL_CUTOFF;
+
+  if (options != NULL) {
+    if (options->serial_cutoff > 0) {
+      pool->serial_cutoff = options->serial_cutoff;
+    }
+
+#if SORT_THREADS
+
+    if ((options->submit != NULL) && (options->wait != NULL)) {
+      pool->executor = options->executor;
+      pool->submit = options->submit;
+      pool->wait = options->wait;
+    }
+
+#endif
+  }
+
+  for (i = 0; i < nthreads; i++) {
+    pool->workers[i].pool = pool;
+    pool->workers[i].id = i;
+    pool->workers[i].bound = -1;
+  }
+
+  pool->nodes = 1;
+
+#if SORT_THREADS
+  pthread_mutex_init(&pool->lock, NULL);
+  SORT_WORKER_INIT(&pool->workers[0]);
+
+  if (pool->submit != NULL) {
+    /* the host's threads show up for each call */
+    for (i = 1; i < nthreads; i++) {
+      SORT_WORKER_INIT(&pool->workers[i]);
+    }
+
+    pool->nthreads = nthreads;
+    return pool;
+  }
+
+  pool->threads = (pthread_t *)malloc((size_t)nthreads * sizeof(pthread_t));
+  SORT_POOL_LOCK(pool);
+
+  /* if we can't get as many threads as we asked for, make do with what we have */
+  for (i = 1; (pool->threads != NULL) && (i < nthreads); i++) {
+    SORT_WORKER_INIT(&pool->workers[i]);
+
+    if (pthread_create(&pool->threads[i], NULL, sort_worker_main, &pool->workers[i]) != 0) {
+      SORT_WORKER_DESTROY(&pool->workers[i]);
+      break;
+    }
+
+    if ((options != NULL) && options->pin_threads) {
+      sort_pin_thread(pool->threads[i], i);
+    }
+  }
+
+  pool->nthreads = (pool->threads != NULL) ? i : 1;
+
+  if (options != NULL) {
+    sort_ctx_split_nodes(pool, options->numa_nodes);
+  }
+
+  SORT_POOL_UNLOCK(pool);
+#else
+  pool->nthreads = 1;
+#endif
+  return pool;
+}
+
+static void sort_ctx_destroy(sort_ctx *pool) {
+  int i;
+#if SORT_THREADS
+  SORT_POOL_LOCK(pool);
+  pool->shutdown = 1;
+
+  for (i = 0; i < pool->nthreads; i++) {
+    sort_pool_wake(pool, &pool->workers[i]);
+  }
+
+  SORT_POOL_UNLOCK(pool);
+
+  for (i = 1; (pool->threads != NULL) && (i < pool->nthreads); i++) {
+    pthread_join(pool->threads[i], NULL);
+  }
+
+  pthread_mutex_destroy(&pool->lock);
+  free(pool->threads);
+#endif
+
+  for (i = 0; i < pool->nthreads; i++) {
+    SORT_WORKER_DESTROY(&pool->workers[i]);
+    free(pool->workers[i].tasks);
+  }
+
+  free(pool->workers);
+  free(pool);
+}
+
+/* Whether a call on size elements should skip the pool altogether. */
+static __inline int sort_ctx_serial(const sort_ctx *ctx, const size_t size) {
+  if (ctx == NULL) {
+    return size <= SORT_PARALLEL_CUTOFF;
+  }
+
+  return (size <= ctx->serial_cutoff) || (ctx->nthreads < 2);
+}
+
+/* Start a parallel call on ctx (NULL for a pool of its own) and return the
+   caller's worker; every call to this needs a matching sort_ctx_end(). */
+static sort_worker *sort_ctx_begin(sort_ctx *ctx) {
+  if (ctx == NULL) {
+    ctx = sort_ctx_create(NULL);
+    ctx->temporary = 1;
+  }
+
+#if SORT_THREADS
+
+  if (ctx->submit != NULL) {
+    int i;
+    SORT_POOL_LOCK(ctx);
+    ctx->running = 1;
+    SORT_POOL_UNLOCK(ctx);
+
+    for (i = 1; i < ctx->nthreads; i++) {
+      ctx->submit(ctx->executor, sort_worker_job, &ctx->workers[i]);
+    }
+  }
+
+#endif
+  return &ctx->workers[0];
+}
+
+static void sort_ctx_end(sort_worker *w) {
+  sort_pool *pool = w->pool;
+#if SORT_THREADS
+
+  if (pool->submit != NULL) {
+    int i;
+    SORT_POOL_LOCK(pool);
+    pool->running = 0;
+
+    for (i = 1; i < pool->nthreads; i++) {
+      sort_pool_wake(pool, &pool->workers[i]);
+    }
+
+    SORT_POOL_UNLOCK(pool);
+    pool->wait(pool->executor);
+  }
+
+#endif
+
+  if (pool->temporary) {
+    sort_ctx_destroy(pool);
+  }
+}
+
+/* How many pieces to split size elements into among threads so each gets at least
+   the cutoff. */
+static __inline size_t sort_chunks_for(const size_t threads, const size_t size) {
+  size_t chunks = size / SORT_PARALLEL_CUTOFF;
+
+  if (chunks > threads) {
+    chunks = threads;
+  }
+
+  if (chunks > SORT_PARALLEL_MAX_CHUNKS) {
+    chunks = SORT_PARALLEL_MAX_CHUNKS;
+  }
+
+  return chunks;
+}
+
+/* The same for a task running on w. */
+static __inline size_t sort_parallel_chunks(const sort_worker *w, const size_t size) {
+  /* a task tied to a node can only share with that node's workers */
+  return sort_chunks_for((size_t)(w->bound >= 0 ? w->node_threads : w->pool->nthreads), size);
+}
+
+/* The same for a call on ctx (NULL for a pool of its own), before the pool is
+   started: calls that can only split into chunks go serial when this is below 2. */
+static __inline size_t sort_ctx_chunks(const sort_ctx *ctx, const size_t size) {
+  return sort_chunks_for((size_t)(ctx != NULL ? ctx->nthreads : sort_cpu_count()), size);
+}
+
+#endif /* SORT_PARALLEL_COMMON_H */
+
+#define PARALLEL_QUICK_SORT            SORT_MAKE_STR(parallel_quick_sort)
+#define PARALLEL_QUICK_SORT_TASK       SORT_MAKE_STR(parallel_quick_sort_task)
+#define PARALLEL_PARTITION             SORT_MAKE_STR(parallel_partition)
+#define PARALLEL_PARTITION_CHUNK       SORT_MAKE_STR(parallel_partition_chunk)
+#define PARALLEL_PARTITION_SWAP        SORT_MAKE_STR(parallel_partition_swap)
+#define PARALLEL_PARTITION_T           SORT_MAKE_STR(parallel_partition_t)
+#define PARALLEL_QUICK_SORT_T          SORT_MAKE_STR(parallel_quick_sort_t)
+#define MERGE_CO_RANK                  SORT_MAKE_STR(merge_co_rank)
+#define MERGE_INTO                     SORT_MAKE_STR(merge_into)
+#define PARALLEL_MERGE                 SORT_MAKE_STR(parallel_merge)
+#define PARALLEL_MERGE_PIECE           SORT_MAKE_STR(parallel_merge_piece)
+#define PARALLEL_MERGE_T               SORT_MAKE_STR(parallel_merge_t)
+#define PARALLEL_COPY_PIECE            SORT_MAKE_STR(parallel_copy_piece)
+#define PARALLEL_TIM_SORT              SORT_MAKE_STR(parallel_tim_sort)
+#define PARALLEL_TIM_SORT_RUNS         SORT_MAKE_STR(parallel_tim_sort_runs)
+#define PARALLEL_TIM_SORT_LEVEL        SORT_MAKE_STR(parallel_tim_sort_level)
+#define PARALLEL_TIM_SORT_T            SORT_MAKE_STR(parallel_tim_sort_t)
+#define PARALLEL_MERGE_SORT            SORT_MAKE_STR(parallel_merge_sort)
+#define PARALLEL_MERGE_SORT_TO_DST     SORT_MAKE_STR(parallel_merge_sort_to_dst)
+#define PARALLEL_MERGE_SORT_TO_NEWDST  SORT_MAKE_STR(parallel_merge_sort_to_newdst)
+#define PARALLEL_MERGE_SORT_T          SORT_MAKE_STR(parallel_merge_sort_t)
+#define PARALLEL_MERGE_SORT_NODE       SORT_MAKE_STR(parallel_merge_sort_node)
+#define PARALLEL_MERGE_SORT_NUMA       SORT_MAKE_STR(parallel_merge_sort_numa)
+#define PARALLEL_MERGE_SORT_NUMA_T     SORT_MAKE_STR(parallel_merge_sort_numa_t)
+#define PARALLEL_MERGE_NUMA            SORT_MAKE_STR(parallel_merge_numa)
+#define PARALLEL_SORT_UNIQUE           SORT_MAKE_STR(parallel_sort_unique)
+#define PARALLEL_SORT_GROUPS           SORT_MAKE_STR(parallel_sort_groups)
+#define PARALLEL_SORT_UNIQUE_RUN       SORT_MAKE_STR(parallel_sort_unique_run)
+#define PARALLEL_SORT_UNIQUE_PIECE     SORT_MAKE_STR(parallel_sort_unique_piece)
+#define PARALLEL_SORT_UNIQUE_SHIFT     SORT_MAKE_STR(parallel_sort_unique_shift)
+#define PARALLEL_SORT_UNIQUE_T         SORT_MAKE_STR(parallel_sort_unique_t)
+#define PARALLEL_SAMPLE_SORT           SORT_MAKE_STR(parallel_sample_sort)
+#define PARALLEL_SAMPLE_SORT_STEP      SORT_MAKE_STR(parallel_sample_sort_step)
+#define PARALLEL_SAMPLE_SORT_CLASSIFY  SORT_MAKE_STR(parallel_sample_sort_classify)
+#define PARALLEL_SAMPLE_SORT_EMPTIES   SORT_MAKE_STR(parallel_sample_sort_empties)
+#define PARALLEL_SAMPLE_SORT_PERMUTE   SORT_MAKE_STR(parallel_sample_sort_permute)
+#define PARALLEL_SAMPLE_SORT_CLEANUP   SORT_MAKE_STR(parallel_sample_sort_cleanup)
+#define PARALLEL_SAMPLE_SORT_BUCKET    SORT_MAKE_STR(parallel_sample_sort_bucket)
+#define PARALLEL_SAMPLE_SORT_T         SORT_MAKE_STR(parallel_sample_sort_t)
+#define PARALLEL_RADIX_SORT            SORT_MAKE_STR(parallel_radix_sort)
+#define PARALLEL_RADIX_SORT_COUNT_ALL  SORT_MAKE_STR(parallel_radix_sort_count_all)
+#define PARALLEL_RADIX_SORT_COUNT      SORT_MAKE_STR(parallel_radix_sort_count)
+#define PARALLEL_RADIX_SORT_SCATTER    SORT_MAKE_STR(parallel_radix_sort_scatter)
+#define PARALLEL_RADIX_SORT_T          SORT_MAKE_STR(parallel_radix_sort_t)
+#define PARALLEL_GRAIL_SORT            SORT_MAKE_STR(parallel_grail_sort)
+#define PARALLEL_GRAIL_SORT_TASK       SORT_MAKE_STR(parallel_grail_sort_task)
+#define PARALLEL_GRAIL_MERGE           SORT_MAKE_STR(parallel_grail_merge)
+#define PARALLEL_GRAIL_MERGE_TASK      SORT_MAKE_STR(parallel_grail_merge_task)
+#define PARALLEL_GRAIL_REVERSE         SORT_MAKE_STR(parallel_grail_reverse)
+#define PARALLEL_GRAIL_REVERSE_PIECE   SORT_MAKE_STR(parallel_grail_reverse_piece)
+#define PARALLEL_GRAIL_SORT_T          SORT_MAKE_STR(parallel_grail_sort_t)
+#define PARALLEL_SHELL_SORT            SORT_MAKE_STR(parallel_shell_sort)
+#define PARALLEL_SHELL_SORT_CHUNK      SORT_MAKE_STR(parallel_shell_sort_chunk)
+#define PARALLEL_SHELL_SORT_T          SORT_MAKE_STR(parallel_shell_sort_t)
+#define PARALLEL_SEGMENTED_SORT        SORT_MAKE_STR(parallel_segmented_sort)
+#define PARALLEL_STABLE_SEGMENTED_SORT SORT_MAKE_STR(parallel_stable_segmented_sort)
+#define PARALLEL_SEGMENTED_SORT_RUN    SORT_MAKE_STR(parallel_segmented_sort_run)
+#define PARALLEL_SEGMENTED_SORT_FIRST  SORT_MAKE_STR(parallel_segmented_sort_first)
+#define PARALLEL_SEGMENTED_SORT_CHUNK  SORT_MAKE_STR(parallel_segmented_sort_chunk)
+#define PARALLEL_SEGMENTED_SORT_T      SORT_MAKE_STR(parallel_segmented_sort_t)
+#define PARALLEL_STRING_SORT           SORT_MAKE_STR(parallel_string_sort)
+#define PARALLEL_STRING_SORT_LCP       SORT_MAKE_STR(parallel_string_sort_lcp)
+#define PARALLEL_STRING_SORT_LOAD      SORT_MAKE_STR(parallel_string_sort_load)
+#define PARALLEL_STRING_SORT_RANGE     SORT_MAKE_STR(parallel_string_sort_range)
+#define PARALLEL_STRING_SORT_SPAWN     SORT_MAKE_STR(parallel_string_sort_spawn)
+#define PARALLEL_STRING_SORT_TASK      SORT_MAKE_STR(parallel_string_sort_task)
+#define PARALLEL_STRING_SORT_T         SORT_MAKE_STR(parallel_string_sort_t)
+#define PARALLEL_STRING_SORT_TASK_T    SORT_MAKE_STR(parallel_string_sort_task_t)
+#define PARALLEL_TOP_K                 SORT_MAKE_STR(parallel_top_k)
+#define PARALLEL_TOP_K_CHUNK           SORT_MAKE_STR(parallel_top_k_chunk)
+#define PARALLEL_TOP_K_T               SORT_MAKE_STR(parallel_top_k_t)
+#define PARALLEL_NTH_ELEMENT           SORT_MAKE_STR(parallel_nth_element)
+#define PARALLEL_KWAY_MERGE            SORT_MAKE_STR(parallel_kway_merge)
+#define PARALLEL_KWAY_MERGE_SPLIT      SORT_MAKE_STR(parallel_kway_merge_split)
+#define PARALLEL_KWAY_MERGE_CUT        SORT_MAKE_STR(parallel_kway_merge_cut)
+#define PARALLEL_KWAY_MERGE_PIECE      SORT_MAKE_STR(parallel_kway_merge_piece)
+#define PARALLEL_KWAY_MERGE_T          SORT_MAKE_STR(parallel_kway_merge_t)
+
+SORT_DEF void PARALLEL_QUICK_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx);
+SORT_DEF void PARALLEL_TIM_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx);
+SORT_DEF void PARALLEL_MERGE_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx);
+SORT_DEF size_t PARALLEL_SORT_UNIQUE(SORT_TYPE *dst, const size_t size, sort_ctx *ctx);
+SORT_DEF size_t PARALLEL_SORT_GROUPS(SORT_TYPE *dst, const size_t size, size_t *starts,
+                                     sort_ctx *ctx);
+SORT_DEF void PARALLEL_SAMPLE_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx);
+SORT_DEF void PARALLEL_SHELL_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx);
+SORT_DEF void PARALLEL_SEGMENTED_SORT(SORT_TYPE *data, const size_t *offsets,
+                                      const size_t nsegments, sort_ctx *ctx);
+SORT_DEF void PARALLEL_STABLE_SEGMENTED_SORT(SORT_TYPE *data, const size_t *offsets,
+    const size_t nsegments, sort_ctx *ctx);
+SORT_DEF size_t PARALLEL_TOP_K(SORT_TYPE *src, const size_t size, const size_t k,
+                               SORT_TYPE *out, sort_ctx *ctx);
+SORT_DEF void PARALLEL_NTH_ELEMENT(SORT_TYPE *dst, const size_t size, const size_t nth,
+                                   sort_ctx *ctx);
+SORT_DEF void PARALLEL_KWAY_MERGE(SORT_TYPE **inputs, const size_t *lens, const size_t k,
+                                  SORT_TYPE *out, sort_ctx *ctx);
+#ifdef SORT_PRIMITIVE
+SORT_DEF void PARALLEL_RADIX_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx);
+#endif
+#ifdef SORT_STRING
+SORT_DEF void PARALLEL_STRING_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx);
+SORT_DEF void PARALLEL_STRING_SORT_LCP(SORT_TYPE *dst, const size_t size, size_t *lcp,
+                                       sort_ctx *ctx);
+#endif
+#ifdef SORT_EXTRA
+SORT_DEF void PARALLEL_GRAIL_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx);
+#endif
+
+/* Cooperative partition of a large range: every chunk partitions itself around
+   value, then the misplaced elements on either side of the global split are
+   swapped across, again split evenly over the workers. */
+typedef struct {
+  SORT_TYPE *dst;
+  SORT_TYPE value;
+  size_t left;
+  size_t size;
+  size_t split;
+  size_t misplaced;
+  size_t less[SORT_PARALLEL_MAX_CHUNKS];
+  int not_all_same[SORT_PARALLEL_MAX_CHUNKS];
+} PARALLEL_PARTITION_T;
+
+static void PARALLEL_PARTITION_CHUNK(sort_worker *w, void *data, size_t chunk, size_t chunks) {
+  PARALLEL_PARTITION_T *p = (PARALLEL_PARTITION_T *)data;
+  SORT_TYPE *dst = p->dst;
+  const size_t start = p->left + chunk * p->size / chunks;
+  const size_t end = p->left + (chunk + 1) * p->size / chunks;
+  size_t index = start;
+  size_t i;
+  int not_all_same = 0;
+  (void)w;
+
+  for (i = start; i < end; i++) {
+    int cmp = SORT_CMP(dst[i], p->value);
+    not_all_same |= cmp;
+
+    if (cmp < 0) {
+      SORT_SWAP(dst[i], dst[index]);
+      index++;
+    }
+  }
+
+  p->less[chunk] = index - start;
+  p->not_all_same[chunk] = not_all_same;
+}
+
+/* Swap the misplaced elements with ranks [piece * misplaced / pieces, ...) across
+   the split.  Left of the split, the misplaced elements are the tails of the chunks;
+   right of it, the heads. */
+static void PARALLEL_PARTITION_SWAP(sort_worker *w, void *data, size_t piece, size_t pieces) {
+  PARALLEL_PARTITION_T *p = (PARALLEL_PARTITION_T *)data;
+  SORT_TYPE *dst = p->dst;
+  const size_t chunks = pieces;
+  const size_t end = p->left + p->size;
+  size_t skip_hi = piece * p->misplaced / pieces;
+  size_t skip_lo = skip_hi;
+  size_t todo = (piece + 1) * p->misplaced / pieces - skip_hi;
+  size_t hi_chunk = 0, lo_chunk = 0;
+  size_t hi = 0, hi_end = 0, lo = 0, lo_end = 0;
+  (void)w;
+
+  while (todo > 0) {
+    /* next element >= value sitting left of the split */
+    while (hi == hi_end) {
+      const size_t start = p->left + hi_chunk * p->size / chunks;
+      const size_t stop = p->left + (hi_chunk + 1) * p->size / chunks;
+      hi = MAX(start + p->less[hi_chunk], p->left);
+      hi_end = MIN(stop, p->split);
+      hi_chunk++;
+
+      if (hi >= hi_end) {
+        hi = hi_end = 0;
+      } else if (skip_hi >= hi_end - hi) {
+        skip_hi -= hi_end - hi;
+        hi = hi_end = 0;
+      } else {
+        hi += skip_hi;
+        skip_hi = 0;
+      }
+    }
+
+    /* next element < value sitting right of the split */
+    while (lo == lo_end) {
+      const size_t start = p->left + lo_chunk * p->size / chunks;
+      lo = MAX(start, p->split);
+      lo_end = MIN(start + p->less[lo_chunk], end);
+      lo_chunk++;
+
+      if (lo >= lo_end) {
+        lo = lo_end = 0;
+      } else if (skip_lo >= lo_end - lo) {
+        skip_lo -= lo_end - lo;
+        lo = lo_end = 0;
+      } else {
+        lo += skip_lo;
+        skip_lo = 0;
+      }
+    }
+
+    SORT_SWAP(dst[hi], dst[lo]);
+    hi++;
+    lo++;
+    todo--;
+  }
+}
+
+/* Same contract as QUICK_SORT_PARTITION, but spread over the pool for big ranges. */
+static size_t PARALLEL_PARTITION(sort_worker *w, SORT_TYPE *dst, const size_t left,
+                                 const size_t right, const size_t pivot) {
+  PARALLEL_PARTITION_T p;
+  const size_t chunks = sort_parallel_chunks(w, right - left);
+  size_t i, misplaced = 0;
+  int not_all_same = 0;
+
+  if (chunks < 2) {
+    return QUICK_SORT_PARTITION(dst, left, right, pivot);
+  }
+
+  /* move the pivot to the right, out of the way */
+  p.value = dst[pivot];
+  SORT_SWAP(dst[pivot], dst[right]);
+  p.dst = dst;
+  p.left = left;
+  p.size = right - left;
+  sort_parallel_for(w, PARALLEL_PARTITION_CHUNK, &p, chunks);
+  p.split = left;
+
+  for (i = 0; i < chunks; i++) {
+    p.split += p.less[i];
+    not_all_same |= p.not_all_same[i];
+  }
+
+  for (i = 0; i < chunks; i++) {
+    const size_t start = left + i * p.size / chunks;
+    const size_t stop = left + (i + 1) * p.size / chunks;
+
+    if (start + p.less[i] < p.split) {
+      misplaced += MIN(stop, p.split) - (start + p.less[i]);
+    }
+  }
+
+  p.misplaced = misplaced;
+  sort_parallel_for(w, PARALLEL_PARTITION_SWAP, &p, chunks);
+  SORT_SWAP(dst[right], dst[p.split]);
+
+  /* avoid degenerate case */
+  if (not_all_same == 0) {
+    return SIZE_MAX;
+  }
+
+  return p.split;
+}
+
+typedef struct {
+  SORT_TYPE *dst;
+  sort_group group;
+} PARALLEL_QUICK_SORT_T;
+
+/* One task of the parallel quick sort: the same steps as QUICK_SORT_RECURSIVE, but
+   the smaller side of each partition is handed to the pool instead of recursed on,
+   until the range is small enough to finish serially. */
+static void PARALLEL_QUICK_SORT_TASK(sort_worker *w, void *data, size_t left, size_t right) {
+  PARALLEL_QUICK_SORT_T *q = (PARALLEL_QUICK_SORT_T *)data;
+  SORT_TYPE *dst = q->dst;
+  size_t pivot;
+  size_t new_pivot;
+  size_t middle;
+  int loop_count = 0;
+  const int max_loops = 64 - CLZ(right - left + 1U); /* ~lg N */
+
+  while (right - left + 1U > SORT_PARALLEL_CUTOFF) {
+    if (++loop_count >= max_loops) {
+      /* we have recursed / looped too many times; switch to heap sort */
+      HEAP_SORT(&dst[left], right - left + 1U);
+      return;
+    }
+
+    /* median of 5 */
+    middle = left + ((right - left) >> 1);
+    pivot = MEDIAN((const SORT_TYPE *) dst, left, middle, right);
+    pivot = MEDIAN((const SORT_TYPE *) dst, left + ((middle - left) >> 1), pivot,
+                   middle + ((right - middle) >> 1));
+    new_pivot = PARALLEL_PARTITION(w, dst, left, right, pivot);
+
+    /* check for partition all equal */
+    if (new_pivot == SIZE_MAX) {
+      return;
+    }
+
+    /* hand the smaller side to the pool and keep going on the larger one */
+    if (new_pivot - left > right - new_pivot) {
+      if (new_pivot < right) {
+        sort_spawn(w, &q->group, PARALLEL_QUICK_SORT_TASK, q, new_pivot + 1U, right);
+      }
+
+      right = new_pivot - 1U;
+    } else {
+      if (new_pivot > left) {
+        sort_spawn(w, &q->group, PARALLEL_QUICK_SORT_TASK, q, left, new_pivot - 1U);
+      }
+
+      left = new_pivot + 1U;
+
+      if (left > right) {
+        return;
+      }
+    }
+  }
+
+  QUICK_SORT_RECURSIVE(dst, left, right);
+}
+
+SORT_DEF void PARALLEL_QUICK_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx) {
+  PARALLEL_QUICK_SORT_T q;
+  sort_worker *w;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size)) {
+    QUICK_SORT(dst, size);
+    return;
+  }
+
+  w = sort_ctx_begin(ctx);
+  q.dst = dst;
+  sort_group_init(w, &q.group);
+  PARALLEL_QUICK_SORT_TASK(w, &q, 0U, size - 1U);
+  sort_group_wait(w, &q.group);
+  sort_ctx_end(w);
+}
+
+
+/* Number of elements of a that land among the first k outputs of a stable merge
+   of a and b (ties go to a). */
+static size_t MERGE_CO_RANK(const size_t k, SORT_TYPE *a, const size_t na,
+                            SORT_TYPE *b, const size_t nb) {
+  size_t lo = k > nb ? k - nb : 0;
+  size_t hi = MIN(k, na);
+
+  while (lo < hi) {
+    const size_t i = lo + ((hi - lo) >> 1);
+    const size_t j = k - i;
+
+    if ((i > 0) && (j < nb) && (SORT_CMP(a[i - 1], b[j]) > 0)) {
+      /* took too many from a */
+      hi = i - 1;
+    } else if ((j > 0) && (i < na) && (SORT_CMP(b[j - 1], a[i]) >= 0)) {
+      /* took too few from a */
+      lo = i + 1;
+    } else {
+      return i;
+    }
+  }
+
+  return lo;
+}
+
+/* Stable merge of a and b into out, which must not overlap either. */
+static void MERGE_INTO(SORT_TYPE *a, const size_t na, SORT_TYPE *b,
+                       const size_t nb, SORT_TYPE *out) {
+  SORT_TYPE *a_end = a + na;
+  SORT_TYPE *b_end = b + nb;
+
+  if ((na > 0) && (nb > 0)) {
+    while (1) {
+      if (SORT_CMP(*a, *b) <= 0) {
+        *out++ = *a++;
+
+        if (a == a_end) {
+          break;
+        }
+      } else {
+        *out++ = *b++;
+
+        if (b == b_end) {
+          break;
+        }
+      }
+    }
+  }
+
+  SORT_TYPE_CPY(out, a, (size_t)(a_end - a));
+  out += a_end - a;
+  SORT_TYPE_CPY(out, b, (size_t)(b_end - b));
+}
+
+typedef struct {
+  SORT_TYPE *a;
+  size_t na;
+  SORT_TYPE *b;
+  size_t nb;
+  SORT_TYPE *out;
+} PARALLEL_MERGE_T;
+
+/* Merge the piece-th equal slice of the output; the slice ends are found by
+   co-ranking, so every piece writes its own part of out. */
+static void PARALLEL_MERGE_PIECE(sort_worker *w, void *data, size_t piece, size_t pieces) {
+  const PARALLEL_MERGE_T *m = (const PARALLEL_MERGE_T *)data;
+  const size_t k0 = piece * (m->na + m->nb) / pieces;
+  const size_t k1 = (piece + 1) * (m->na + m->nb) / pieces;
+  const size_t i0 = MERGE_CO_RANK(k0, m->a, m->na, m->b, m->nb);
+  const size_t i1 = MERGE_CO_RANK(k1, m->a, m->na, m->b, m->nb);
+  (void)w;
+  MERGE_INTO(m->a + i0, i1 - i0, m->b + (k0 - i0), (k1 - i1) - (k0 - i0), m->out + k0);
+}
+
+static void PARALLEL_MERGE(sort_worker *w, SORT_TYPE *a, const size_t na,
+                           SORT_TYPE *b, const size_t nb, SORT_TYPE *out) {
+  PARALLEL_MERGE_T m;
+  const size_t pieces = sort_parallel_chunks(w, na + nb);
+
+  if (pieces < 2) {
+    MERGE_INTO(a, na, b, nb, out);
+    return;
+  }
+
+  m.a = a;
+  m.na = na;
+  m.b = b;
+  m.nb = nb;
+  m.out = out;
+  sort_parallel_for(w, PARALLEL_MERGE_PIECE, &m, pieces);
+}
+
+static void PARALLEL_COPY_PIECE(sort_worker *w, void *data, size_t piece, size_t pieces) {
+  const PARALLEL_MERGE_T *m = (const PARALLEL_MERGE_T *)data;
+  const size_t start = piece * m->na / pieces;
+  const size_t end = (piece + 1) * m->na / pieces;
+  (void)w;
+  SORT_TYPE_CPY(m->out + start, m->a + start, end - start);
+}
+
+/* Parallel timsort: chunks find (and minrun-extend) their runs concurrently exactly
+   like PUSH_NEXT does, then the runs are merged pairwise as a balanced tree, each
+   level's merges running side by side and big merges split by co-ranking. */
+typedef struct {
+  SORT_TYPE *dst;
+  SORT_TYPE *src;
+  SORT_TYPE *out;
+  size_t size;
+  size_t chunks;
+  size_t minrun;
+  size_t chunk_runs; /* capacity of each chunk's slice of bounds */
+  size_t *counts;
+  size_t *bounds;
+  size_t nruns;
+} PARALLEL_TIM_SORT_T;
+
+static void PARALLEL_TIM_SORT_RUNS(sort_worker *w, void *data, size_t chunk, size_t chunks) {
+  PARALLEL_TIM_SORT_T *t = (PARALLEL_TIM_SORT_T *)data;
+  const size_t start = chunk * t->size / chunks;
+  const size_t size = (chunk + 1) * t->size / chunks - start;
+  SORT_TYPE *dst = t->dst + start;
+  size_t *bounds = t->bounds + chunk * t->chunk_runs;
+  size_t count = 0;
+  size_t curr = 0;
+  (void)w;
+
+  while (curr < size) {
+    size_t len = COUNT_RUN(dst, curr, size);
+    size_t run = t->minrun;
+
+    if (run > size - curr) {
+      run = size - curr;
+    }
+
+    if (run > len) {
+      BINARY_INSERTION_SORT_START(&dst[curr], len, run);
+      len = run;
+    }
+
+    bounds[count++] = start + curr;
+    curr += len;
+  }
+
+  t->counts[chunk] = count;
+}
+
+/* Merge run pair i of the current level from src into out. */
+static void PARALLEL_TIM_SORT_LEVEL(sort_worker *w, void *data, size_t pair, size_t pairs) {
+  const PARALLEL_TIM_SORT_T *t = (const PARALLEL_TIM_SORT_T *)data;
+  const size_t start = t->bounds[2 * pair];
+  const size_t middle = t->bounds[MIN(2 * pair + 1, t->nruns)];
+  const size_t end = t->bounds[MIN(2 * pair + 2, t->nruns)];
+  (void)pairs;
+
+  if (middle == end) {
+    /* odd one out; just carry it over */
+    PARALLEL_MERGE_T m;
+    const size_t pieces = sort_parallel_chunks(w, end - start);
+    m.a = t->src + start;
+    m.na = end - start;
+    m.out = t->out + start;
+
+    if (pieces < 2) {
+      PARALLEL_COPY_PIECE(w, &m, 0, 1);
+    } else {
+      sort_parallel_for(w, PARALLEL_COPY_PIECE, &m, pieces);
+    }
+
+    return;
+  }
+
+  PARALLEL_MERGE(w, t->src + start, middle - start, t->src + middle, end - middle,
+                 t->out + start);
+}
+
+SORT_DEF void PARALLEL_TIM_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx) {
+  PARALLEL_TIM_SORT_T t;
+  sort_worker *w;
+  SORT_TYPE *buffer;
+  size_t i, c;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size) || (sort_ctx_chunks(ctx, size) < 2)) {
+    TIM_SORT(dst, size);
+    return;
+  }
+
+  w = sort_ctx_begin(ctx);
+  t.chunks = sort_parallel_chunks(w, size);
+
+  t.dst = dst;
+  t.size = size;
+  t.minrun = (size_t)compute_minrun(size);
+  t.chunk_runs = (size + t.chunks - 1) / t.chunks / t.minrun + 2;
+  t.counts = (size_t *)malloc(t.chunks * sizeof(size_t));
+  t.bounds = (size_t *)malloc((t.chunks * t.chunk_runs + 1) * sizeof(size_t));
+  buffer = SORT_NEW_BUFFER(size);
+
+  if ((t.counts == NULL) || (t.bounds == NULL) || (buffer == NULL)) {
+    fprintf(stderr, "Error allocating temporary storage for parallel tim sort: need %lu bytes",
+            (unsigned long)(sizeof(SORT_TYPE) * size));
+    exit(1);
+  }
+
+  sort_parallel_for(w, PARALLEL_TIM_SORT_RUNS, &t, t.chunks);
+  /* pack the run starts together, gluing together runs that continue across a
+     chunk boundary */
+  t.nruns = 0;
+
+  for (c = 0; c < t.chunks; c++) {
+    for (i = 0; i < t.counts[c]; i++) {
+      const size_t start = t.bounds[c * t.chunk_runs + i];
+
+      if ((i == 0) && (t.nruns > 0) && (SORT_CMP(dst[start - 1], dst[start]) <= 0)) {
+        continue;
+      }
+
+      t.bounds[t.nruns++] = start;
+    }
+  }
+
+  t.bounds[t.nruns] = size;
+  t.src = dst;
+  t.out = buffer;
+
+  while (t.nruns > 1) {
+    const size_t pairs = (t.nruns + 1) / 2;
+    SORT_TYPE *tmp;
+    sort_parallel_for(w, PARALLEL_TIM_SORT_LEVEL, &t, pairs);
+
+    for (i = 0; i < pairs; i++) {
+      t.bounds[i] = t.bounds[2 * i];
+    }
+
+    t.bounds[pairs] = size;
+    t.nruns = pairs;
+    tmp = t.src;
+    t.src = t.out;
+    t.out = tmp;
+  }
+
+  if (t.src != dst) {
+    PARALLEL_MERGE_T m;
+    m.a = t.src;
+    m.na = size;
+    m.out = dst;
+    sort_parallel_for(w, PARALLEL_COPY_PIECE, &m, t.chunks);
+  }
+
+  SORT_DELETE_BUFFER(buffer);
+  free(t.bounds);
+  free(t.counts);
+  sort_ctx_end(w);
+}
+
+/* Parallel merge sort: both halves sort concurrently, and each merge is cut into
+   equal slices by merge path (co-ranking) so every worker writes its own part of
+   the output.  The halves are sorted into the other buffer from the one the merge
+   writes to, so no level has to copy its result back. */
+typedef struct {
+  SORT_TYPE *dst;
+  SORT_TYPE *newdst;
+} PARALLEL_MERGE_SORT_T;
+
+static void PARALLEL_MERGE_SORT_TO_NEWDST(sort_worker *w, void *data, size_t begin, size_t end);
+
+/* Sort dst[begin, end) in place. */
+static void PARALLEL_MERGE_SORT_TO_DST(sort_worker *w, void *data, size_t begin, size_t end) {
+  PARALLEL_MERGE_SORT_T *m = (PARALLEL_MERGE_SORT_T *)data;
+  const size_t middle = begin + ((end - begin) >> 1);
+  sort_group group;
+
+  if (end - begin <= SORT_PARALLEL_CUTOFF) {
+    MERGE_SORT_RECURSIVE(m->newdst + begin, m->dst + begin, end - begin);
+    return;
+  }
+
+  sort_group_init(w, &group);
+  sort_spawn(w, &group, PARALLEL_MERGE_SORT_TO_NEWDST, m, begin, middle);
+  PARALLEL_MERGE_SORT_TO_NEWDST(w, m, middle, end);
+  sort_group_wait(w, &group);
+  PARALLEL_MERGE(w, m->newdst + begin, middle - begin, m->newdst + middle, end - middle,
+                 m->dst + begin);
+}
+
+/* Sort dst[begin, end) into newdst[begin, end). */
+static void PARALLEL_MERGE_SORT_TO_NEWDST(sort_worker *w, void *data, size_t begin, size_t end) {
+  PARALLEL_MERGE_SORT_T *m = (PARALLEL_MERGE_SORT_T *)data;
+  const size_t middle = begin + ((end - begin) >> 1);
+  sort_group group;
+
+  if (end - begin <= SORT_PARALLEL_CUTOFF) {
+    MERGE_SORT_RECURSIVE(m->newdst + begin, m->dst + begin, end - begin);
+    SORT_TYPE_CPY(m->newdst + begin, m->dst + begin, end - begin);
+    return;
+  }
+
+  sort_group_init(w, &group);
+  sort_spawn(w, &group, PARALLEL_MERGE_SORT_TO_DST, m, begin, middle);
+  PARALLEL_MERGE_SORT_TO_DST(w, m, middle, end);
+  sort_group_wait(w, &group);
+  PARALLEL_MERGE(w, m->dst + begin, middle - begin, m->dst + middle, end - middle,
+                 m->newdst + begin);
+}
+
+/* NUMA: every node sorts its own share of the array with its own workers, using the
+   same share of newdst as scratch so that is first touched (and so placed) there
+   too.  Only the merges of the nodes' runs read across nodes, and each piece of
+   those runs on the node that owns the part of the output it writes. */
+typedef struct {
+  PARALLEL_MERGE_SORT_T m;
+  size_t size;
+  int to_newdst; /* where the nodes leave their runs, so the last merge ends in dst */
+} PARALLEL_MERGE_SORT_NUMA_T;
+
+static void PARALLEL_MERGE_SORT_NODE(sort_worker *w, void *data, size_t node, size_t nodes) {
+  PARALLEL_MERGE_SORT_NUMA_T *n = (PARALLEL_MERGE_SORT_NUMA_T *)data;
+  const size_t begin = node * n->size / nodes;
+  const size_t end = (node + 1) * n->size / nodes;
+
+  if (n->to_newdst) {
+    PARALLEL_MERGE_SORT_TO_NEWDST(w, &n->m, begin, end);
+  } else {
+    PARALLEL_MERGE_SORT_TO_DST(w, &n->m, begin, end);
+  }
+}
+
+/* PARALLEL_MERGE for a merge whose output starts offset elements into an array of
+   size elements shared out between the nodes. */
+static void PARALLEL_MERGE_NUMA(sort_worker *w, PARALLEL_MERGE_T *m, const size_t offset,
+                                const size_t size) {
+  const size_t nodes = (size_t)w->pool->nodes;
+  const size_t pieces = MAX(sort_parallel_chunks(w, m->na + m->nb), 1);
+  sort_group group;
+  size_t i;
+  sort_group_init(w, &group);
+
+  for (i = 0; i < pieces; i++) {
+    const size_t k = offset + i * (m->na + m->nb) / pieces;
+    sort_spawn_on(w, (int)(k / ((size + nodes - 1) / nodes)), &group, PARALLEL_MERGE_PIECE, m, i,
+                  pieces);
+  }
+
+  sort_group_wait(w, &group);
+}
+
+static void PARALLEL_MERGE_SORT_NUMA(sort_worker *w, SORT_TYPE *dst, SORT_TYPE *newdst,
+                                     const size_t size) {
+  const size_t nodes = (size_t)w->pool->nodes;
+  PARALLEL_MERGE_SORT_NUMA_T n;
+  PARALLEL_MERGE_T m;
+  SORT_TYPE *src;
+  SORT_TYPE *out;
+  SORT_TYPE *tmp;
+  sort_group group;
+  size_t width, i;
+  int levels = 0;
+
+  while (((size_t)1 << levels) < nodes) {
+    levels++;
+  }
+
+  n.m.dst = dst;
+  n.m.newdst = newdst;
+  n.size = size;
+  n.to_newdst = levels & 1;
+  sort_group_init(w, &group);
+
+  for (i = 0; i < nodes; i++) {
+    sort_spawn_on(w, (int)i, &group, PARALLEL_MERGE_SORT_NODE, &n, i, nodes);
+  }
+
+  sort_group_wait(w, &group);
+  src = n.to_newdst ? newdst : dst;
+  out = n.to_newdst ? dst : newdst;
+
+  /* merge the nodes' runs pairwise; a run without a partner is merged with nothing */
+  for (width = 1; width < nodes; width *= 2) {
+    for (i = 0; i < nodes; i += 2 * width) {
+      const size_t begin = i * size / nodes;
+      const size_t middle = MIN(i + width, nodes) * size / nodes;
+      const size_t end = MIN(i + 2 * width, nodes) * size / nodes;
+      m.a = src + begin;
+      m.na = middle - begin;
+      m.b = src + middle;
+      m.nb = end - middle;
+      m.out = out + begin;
+      PARALLEL_MERGE_NUMA(w, &m, begin, size);
+    }
+
+    tmp = src;
+    src = out;
+    out = tmp;
+  }
+}
+
+SORT_DEF void PARALLEL_MERGE_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx) {
+  PARALLEL_MERGE_SORT_T m;
+  sort_worker *w;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size)) {
+    MERGE_SORT(dst, size);
+    return;
+  }
+
+  m.dst = dst;
+  m.newdst = SORT_NEW_BUFFER(size);
+
+  if (m.newdst == NULL) {
+    fprintf(stderr, "Error allocating temporary storage for parallel merge sort: need %lu bytes",
+            (unsigned long)(sizeof(SORT_TYPE) * size));
+    exit(1);
+  }
+
+  w = sort_ctx_begin(ctx);
+
+  if (w->pool->nodes > 1) {
+    sort_ctx_place(w->pool, m.newdst, size, sizeof(SORT_TYPE));
+    PARALLEL_MERGE_SORT_NUMA(w, dst, m.newdst, size);
+  } else if (w->pool->nthreads > 1) {
+    PARALLEL_MERGE_SORT_TO_DST(w, &m, 0, size);
+  } else {
+    MERGE_SORT_RECURSIVE(m.newdst, dst, size);
+  }
+
+  sort_ctx_end(w);
+  SORT_DELETE_BUFFER(m.newdst);
+}
+
+/* Parallel sorted unique and groups: the halves are merge sorted as above, and the
+   last merge is cut into slices by co-ranking as usual, but every piece drops the
+   duplicates (or notes where the groups start) of its slice as it merges, the group
+   starts going to its own slice of starts.  Then the counts are added up, and what
+   every piece kept is moved to its place in the result. */
+typedef struct {
+  PARALLEL_MERGE_SORT_T m;
+  PARALLEL_MERGE_T merge;
+  size_t *starts;
+  int unique;
+  size_t found[SORT_PARALLEL_MAX_CHUNKS];
+  size_t offsets[SORT_PARALLEL_MAX_CHUNKS];
+} PARALLEL_SORT_UNIQUE_T;
+
+static void PARALLEL_SORT_UNIQUE_PIECE(sort_worker *w, void *data, size_t piece, size_t pieces) {
+  PARALLEL_SORT_UNIQUE_T *u = (PARALLEL_SORT_UNIQUE_T *)data;
+  const PARALLEL_MERGE_T *m = &u->merge;
+  const size_t k0 = piece * (m->na + m->nb) / pieces;
+  const size_t k1 = (piece + 1) * (m->na + m->nb) / pieces;
+  const size_t i0 = MERGE_CO_RANK(k0, m->a, m->na, m->b, m->nb);
+  const size_t i1 = MERGE_CO_RANK(k1, m->a, m->na, m->b, m->nb);
+  const size_t j0 = k0 - i0;
+  SORT_TYPE *prev = NULL;
+  (void)w;
+
+  /* the element just before the slice is the bigger of the two taken last */
+  if ((i0 > 0) && ((j0 == 0) || (SORT_CMP(m->a[i0 - 1], m->b[j0 - 1]) > 0))) {
+    prev = &m->a[i0 - 1];
+  } else if (j0 > 0) {
+    prev = &m->b[j0 - 1];
+  }
+
+  u->found[piece] = SORT_UNIQUE_MERGE(m->a + i0, i1 - i0, m->b + j0, (k1 - i1) - j0,
+                                      m->out + k0, prev, u->unique,
+                                      (u->starts != NULL) ? u->starts + k0 : NULL, k0);
+}
+
+static void PARALLEL_SORT_UNIQUE_SHIFT(sort_worker *w, void *data, size_t piece, size_t pieces) {
+  PARALLEL_SORT_UNIQUE_T *u = (PARALLEL_SORT_UNIQUE_T *)data;
+  const size_t k0 = piece * (u->merge.na + u->merge.nb) / pieces;
+  (void)w;
+  SORT_TYPE_CPY(u->m.dst + u->offsets[piece], u->merge.out + k0, u->found[piece]);
+}
+
+static size_t PARALLEL_SORT_UNIQUE_RUN(SORT_TYPE *dst, const size_t size, const int unique,
+                                       size_t *starts, sort_ctx *ctx) {
+  PARALLEL_SORT_UNIQUE_T u;
+  sort_worker *w;
+  sort_group group;
+  size_t pieces, i;
+  size_t found = 0;
+  /* the halves are sorted into the buffer the last merge doesn't write to */
+  const sort_task_fn half = unique ? PARALLEL_MERGE_SORT_TO_DST : PARALLEL_MERGE_SORT_TO_NEWDST;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size) || (sort_ctx_chunks(ctx, size) < 2)) {
+    return SORT_UNIQUE_RUN(dst, size, unique, starts);
+  }
+
+  w = sort_ctx_begin(ctx);
+  pieces = sort_parallel_chunks(w, size);
+
+  u.m.dst = dst;
+  u.m.newdst = SORT_NEW_BUFFER(size);
+
+  if (u.m.newdst == NULL) {
+    fprintf(stderr, "Error allocating temporary storage for parallel sorted unique: need %lu bytes",
+            (unsigned long)(sizeof(SORT_TYPE) * size));
+    exit(1);
+  }
+
+  u.starts = starts;
+  u.unique = unique;
+  u.merge.a = unique ? dst : u.m.newdst;
+  u.merge.na = size / 2;
+  u.merge.b = u.merge.a + size / 2;
+  u.merge.nb = size - size / 2;
+  u.merge.out = unique ? u.m.newdst : dst;
+  sort_group_init(w, &group);
+  sort_spawn(w, &group, half, &u.m, 0, size / 2);
+  half(w, &u.m, size / 2, size);
+  sort_group_wait(w, &group);
+  sort_parallel_for(w, PARALLEL_SORT_UNIQUE_PIECE, &u, pieces);
+
+  for (i = 0; i < pieces; i++) {
+    u.offsets[i] = found;
+
+    /* a piece's group starts can land on the slices of the pieces before it, so they
+       are moved down here, in order; that copies indexes and compares nothing */
+    if (!unique && (starts != NULL)) {
+      memmove(starts + found, starts + i * size / pieces, u.found[i] * sizeof(size_t));
+    }
+
+    found += u.found[i];
+  }
+
+  if (unique) {
+    sort_parallel_for(w, PARALLEL_SORT_UNIQUE_SHIFT, &u, pieces);
+  }
+
+  sort_ctx_end(w);
+  SORT_DELETE_BUFFER(u.m.newdst);
+  return found;
+}
+
+SORT_DEF size_t PARALLEL_SORT_UNIQUE(SORT_TYPE *dst, const size_t size, sort_ctx *ctx) {
+  return PARALLEL_SORT_UNIQUE_RUN(dst, size, 1, NULL, ctx);
+}
+
+SORT_DEF size_t PARALLEL_SORT_GROUPS(SORT_TYPE *dst, const size_t size, size_t *starts,
+                                     sort_ctx *ctx) {
+  return PARALLEL_SORT_UNIQUE_RUN(dst, size, 0, starts, ctx);
+}
+
+/* Parallel sample sort: each level of SAMPLE_SORT with every step spread over the
+   pool.  Every chunk classifies its own stripe into its own buffers; the buckets are
+   then shared out to tidy up their blocks, to take turns moving blocks home (the
+   only step that needs locks, one per bucket), and to fill in their ends.  Buckets that are still
+   big get another parallel level, the rest are sorted serially as separate tasks. */
+typedef struct {
+  SORT_TYPE *base;
+  SORT_TYPE *dst;        /* the range being partitioned */
+  size_t size;
+  size_t stripe;         /* elements classified by each chunk, a whole number of blocks */
+  size_t chunks;
+  SAMPLE_SORT_CLASSIFIER_T classifier;
+  SAMPLE_SORT_BUFFERS_T *buffers; /* one set per chunk */
+  SORT_TYPE *overflow;
+  SORT_TYPE *saved;      /* one block per chunk, for spills crossing into its buckets */
+  size_t *counts;        /* bucket sizes in each stripe */
+  size_t full[SORT_PARALLEL_MAX_CHUNKS];
+  size_t saved_len[SORT_PARALLEL_MAX_CHUNKS];
+  size_t saved_in[SAMPLE_SORT_MAX_BUCKETS];
+  size_t bounds[SAMPLE_SORT_MAX_BUCKETS + 1];
+  size_t write[SAMPLE_SORT_MAX_BUCKETS];
+  size_t read[SAMPLE_SORT_MAX_BUCKETS];
+  size_t reading[SAMPLE_SORT_MAX_BUCKETS];
+  sort_lock locks[SAMPLE_SORT_MAX_BUCKETS]; /* guard write, read and reading */
+  size_t threshold;      /* buckets bigger than this get a parallel level of their own */
+  uint64_t rng;
+  sort_group group;
+} PARALLEL_SAMPLE_SORT_T;
+
+static void PARALLEL_SAMPLE_SORT_CLASSIFY(sort_worker *w, void *data, size_t chunk,
+    size_t chunks) {
+  PARALLEL_SAMPLE_SORT_T *p = (PARALLEL_SAMPLE_SORT_T *)data;
+  const size_t begin = MIN(chunk * p->stripe, p->size);
+  const size_t end = MIN(begin + p->stripe, p->size);
+  (void)w;
+  (void)chunks;
+  p->full[chunk] = SAMPLE_SORT_LOCAL(&p->classifier, &p->buffers[chunk], p->dst, begin, end,
+                                     p->counts + chunk * p->classifier.nbuckets);
+}
+
+/* Each stripe left its full blocks at its front, so a bucket's region has gaps:
+   move the full blocks at the back of every region down into the empty slots at
+   the front, ready for the permutation. */
+static void PARALLEL_SAMPLE_SORT_EMPTIES(sort_worker *w, void *data, size_t piece,
+    size_t pieces) {
+  PARALLEL_SAMPLE_SORT_T *p = (PARALLEL_SAMPLE_SORT_T *)data;
+  const size_t block = SAMPLE_SORT_BLOCK;
+  const size_t nbuckets = p->classifier.nbuckets;
+  size_t t;
+  (void)w;
+
+  for (t = piece * nbuckets / pieces; t < (piece + 1) * nbuckets / pieces; t++) {
+    size_t i = SAMPLE_SORT_ROUND(p->bounds[t]);
+    size_t j = SAMPLE_SORT_ROUND(p->bounds[t + 1]);
+    p->write[t] = i;
+
+    while (1) {
+      while ((i < j) && (i < p->size) && (i < p->full[i / p->stripe])) {
+        i += block;
+      }
+
+      while ((j > i) && !((j - block < p->size) && (j - block < p->full[(j - block) / p->stripe]))) {
+        j -= block;
+      }
+
+      if (i >= j) {
+        break;
+      }
+
+      SORT_TYPE_CPY(p->dst + i, p->dst + j - block, block);
+      i += block;
+      j -= block;
+    }
+
+    p->read[t] = i;
+    p->reading[t] = 0;
+  }
+}
+
+/* Same as the permutation in SAMPLE_SORT_PARTITION, but with the bucket pointers
+   shared: they are only moved with that bucket's lock held, and nobody writes to
+   an empty slot of a bucket while a block of that bucket is still being read out. */
+static void PARALLEL_SAMPLE_SORT_PERMUTE(sort_worker *w, void *data, size_t piece,
+    size_t pieces) {
+  PARALLEL_SAMPLE_SORT_T *p = (PARALLEL_SAMPLE_SORT_T *)data;
+  const size_t block = SAMPLE_SORT_BLOCK;
+  const size_t nbuckets = p->classifier.nbuckets;
+  SORT_TYPE *swap = p->buffers[piece].swap;
+  size_t k;
+  (void)w;
+
+  for (k = 0; k < nbuckets; k++) {
+    const size_t i = (piece * nbuckets / pieces + k) % nbuckets;
+
+    while (1) {
+      SORT_TYPE *current = swap;
+      size_t pos, t;
+      SORT_LOCK(&p->locks[i]);
+
+      if (p->read[i] <= p->write[i]) {
+        SORT_UNLOCK(&p->locks[i]);
+        break;
+      }
+
+      p->read[i] -= block;
+      pos = p->read[i];
+      p->reading[i]++;
+      SORT_UNLOCK(&p->locks[i]);
+      SORT_TYPE_CPY(current, p->dst + pos, block);
+      SORT_LOCK(&p->locks[i]);
+
+      if (--p->reading[i] == 0) {
+        SORT_LOCK_WAKE(&p->locks[i]);
+      }
+
+      SORT_UNLOCK(&p->locks[i]);
+
+      while (1) {
+        int unread;
+        t = SAMPLE_SORT_CLASSIFY(&p->classifier, current[0]);
+        SORT_LOCK(&p->locks[t]);
+        pos = p->write[t];
+        p->write[t] += block;
+        unread = pos < p->read[t];
+
+        while (!unread && (p->reading[t] > 0)) {
+          SORT_LOCK_WAIT(&p->locks[t]);
+        }
+
+        SORT_UNLOCK(&p->locks[t]);
+
+        if (unread) {
+          SORT_TYPE *next = (current == swap) ? swap + block : swap;
+          SORT_TYPE_CPY(next, p->dst + pos, block);
+          SORT_TYPE_CPY(p->dst + pos, current, block);
+          current = next;
+        } else {
+          if (pos + block > p->size) {
+            /* only one block can end up past the end */
+            SORT_TYPE_CPY(p->overflow, current, block);
+          } else {
+            SORT_TYPE_CPY(p->dst + pos, current, block);
+          }
+
+          break;
+        }
+      }
+    }
+  }
+}
+
+static void PARALLEL_SAMPLE_SORT_CLEANUP(sort_worker *w, void *data, size_t piece,
+    size_t pieces) {
+  PARALLEL_SAMPLE_SORT_T *p = (PARALLEL_SAMPLE_SORT_T *)data;
+  const size_t block = SAMPLE_SORT_BLOCK;
+  const size_t nbuckets = p->classifier.nbuckets;
+  size_t t;
+  (void)w;
+
+  for (t = piece * nbuckets / pieces; t < (piece + 1) * nbuckets / pieces; t++) {
+    SORT_TYPE *spill = p->buffers[piece].swap;
+    size_t spill_len;
+
+    if (p->saved_in[t] != SIZE_MAX) {
+      spill = p->saved + p->saved_in[t] * block;
+      spill_len = p->saved_len[p->saved_in[t]];
+    } else {
+      spill_len = SAMPLE_SORT_SPILL(p->dst, p->size, p->bounds[t], p->bounds[t + 1], p->write[t],
+                                    p->overflow, spill);
+    }
+
+    SAMPLE_SORT_CLEANUP(p->dst, t, p->bounds[t], p->bounds[t + 1], p->write[t], spill, spill_len,
+                        p->buffers, p->chunks);
+  }
+}
+
+static void PARALLEL_SAMPLE_SORT_BUCKET(sort_worker *w, void *data, size_t begin, size_t end) {
+  PARALLEL_SAMPLE_SORT_T *p = (PARALLEL_SAMPLE_SORT_T *)data;
+  (void)w;
+
+  if (end - begin <= SMALL_SORT_BND) {
+    SMALL_SORT(p->base + begin, end - begin);
+  } else {
+    SAMPLE_SORT(p->base + begin, end - begin);
+  }
+}
+
+/* One parallel level of sample sort over dst[0, size). */
+static void PARALLEL_SAMPLE_SORT_STEP(sort_worker *w, PARALLEL_SAMPLE_SORT_T *p,
+                                      SORT_TYPE *dst, const size_t size, const int budget) {
+  const size_t block = SAMPLE_SORT_BLOCK;
+  const size_t chunks = sort_parallel_chunks(w, size);
+  size_t bounds[SAMPLE_SORT_MAX_BUCKETS + 1];
+  size_t nbuckets, i, t;
+  int equal_buckets;
+
+  if ((chunks < 2) || (budget <= 0)) {
+    sort_spawn(w, &p->group, PARALLEL_SAMPLE_SORT_BUCKET, p, (size_t)(dst - p->base),
+               (size_t)(dst - p->base) + size);
+    return;
+  }
+
+  SAMPLE_SORT_BUILD(&p->classifier, dst, size, &p->rng);
+  nbuckets = p->classifier.nbuckets;
+  equal_buckets = p->classifier.equal_buckets;
+  p->dst = dst;
+  p->size = size;
+  p->chunks = chunks;
+  p->stripe = SAMPLE_SORT_ROUND((size + chunks - 1) / chunks);
+  sort_parallel_for(w, PARALLEL_SAMPLE_SORT_CLASSIFY, p, chunks);
+  p->bounds[0] = 0;
+
+  for (t = 0; t < nbuckets; t++) {
+    p->bounds[t + 1] = p->bounds[t];
+
+    for (i = 0; i < chunks; i++) {
+      p->bounds[t + 1] += p->counts[i * nbuckets + t];
+    }
+
+    p->saved_in[t] = SIZE_MAX;
+  }
+
+  sort_parallel_for(w, PARALLEL_SAMPLE_SORT_EMPTIES, p, chunks);
+  sort_parallel_for(w, PARALLEL_SAMPLE_SORT_PERMUTE, p, chunks);
+
+  for (t = 0; t < nbuckets; t++) {
+    if (p->write[t] > size) {
+      const size_t start = p->write[t] - block;
+      SORT_TYPE_CPY(dst + start, p->overflow, size - start);
+    }
+  }
+
+  /* A spill that runs into the buckets of the next chunk would be overwritten
+     while still needed: take a copy first.  Only one bucket can spill past any
+     given point. */
+  for (i = 1; i < chunks; i++) {
+    const size_t first = i * nbuckets / chunks;
+    const size_t edge = p->bounds[first];
+
+    for (t = first; (t > 0) && (p->bounds[t] + block > edge); t--) {
+      if ((p->write[t - 1] > edge) && (p->saved_in[t - 1] == SIZE_MAX) &&
+          (p->write[t - 1] > SAMPLE_SORT_ROUND(p->bounds[t - 1]))) {
+        p->saved_len[i] = SAMPLE_SORT_SPILL(dst, size, p->bounds[t - 1], p->bounds[t],
+                                            p->write[t - 1], p->overflow, p->saved + i * block);
+        p->saved_in[t - 1] = i;
+        break;
+      }
+    }
+  }
+
+  sort_parallel_for(w, PARALLEL_SAMPLE_SORT_CLEANUP, p, chunks);
+  /* the next level reuses p */
+  memcpy(bounds, p->bounds, (nbuckets + 1) * sizeof(size_t));
+
+  for (t = 0; t < nbuckets; t++) {
+    const size_t n = bounds[t + 1] - bounds[t];
+
+    if ((equal_buckets && (t & 1)) || (n <= 1) || (n > p->threshold)) {
+      continue;
+    }
+
+    sort_spawn(w, &p->group, PARALLEL_SAMPLE_SORT_BUCKET, p, (size_t)(dst - p->base) + bounds[t],
+               (size_t)(dst - p->base) + bounds[t + 1]);
+  }
+
+  for (t = 0; t < nbuckets; t++) {
+    const size_t n = bounds[t + 1] - bounds[t];
+
+    if (!(equal_buckets && (t & 1)) && (n > p->threshold)) {
+      PARALLEL_SAMPLE_SORT_STEP(w, p, dst + bounds[t], n, budget - 1);
+    }
+  }
+}
+
+SORT_DEF void PARALLEL_SAMPLE_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx) {
+  const size_t block = SAMPLE_SORT_BLOCK;
+  PARALLEL_SAMPLE_SORT_T *p;
+  SORT_TYPE *memory;
+  sort_worker *w;
+  size_t chunks, i;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size) || (size <= SAMPLE_SORT_BASE_CASE)) {
+    SAMPLE_SORT(dst, size);
+    return;
+  }
+
+  w = sort_ctx_begin(ctx);
+
+  if (w->pool->nthreads < 2) {
+    sort_ctx_end(w);
+    SAMPLE_SORT(dst, size);
+    return;
+  }
+
+  chunks = MIN((size_t)w->pool->nthreads, SORT_PARALLEL_MAX_CHUNKS);
+  p = (PARALLEL_SAMPLE_SORT_T *)malloc(sizeof(PARALLEL_SAMPLE_SORT_T));
+  memory = SORT_NEW_BUFFER(2 * SAMPLE_SORT_MAX_BUCKETS +
+                           chunks * (SAMPLE_SORT_MAX_BUCKETS + 3) * block + block);
+
+  if ((p == NULL) || (memory == NULL)) {
+    fprintf(stderr, "Error allocating temporary storage for parallel sample sort");
+    exit(1);
+  }
+
+  p->buffers = (SAMPLE_SORT_BUFFERS_T *)malloc(chunks * sizeof(SAMPLE_SORT_BUFFERS_T));
+  p->counts = (size_t *)malloc(chunks * SAMPLE_SORT_MAX_BUCKETS * sizeof(size_t));
+
+  if ((p->buffers == NULL) || (p->counts == NULL)) {
+    fprintf(stderr, "Error allocating temporary storage for parallel sample sort");
+    exit(1);
+  }
+
+  for (i = 0; i < SAMPLE_SORT_MAX_BUCKETS; i++) {
+    SORT_LOCK_INIT(&p->locks[i]);
+  }
+
+  p->classifier.tree = memory;
+  p->classifier.splitters = memory + SAMPLE_SORT_MAX_BUCKETS;
+  p->overflow = memory + 2 * SAMPLE_SORT_MAX_BUCKETS;
+  p->saved = p->overflow + block;
+
+  for (i = 0; i < chunks; i++) {
+    p->buffers[i].buffers = p->saved + chunks * block + i * (SAMPLE_SORT_MAX_BUCKETS + 2) * block;
+    p->buffers[i].swap = p->buffers[i].buffers + SAMPLE_SORT_MAX_BUCKETS * block;
+  }
+
+  p->base = dst;
+  p->threshold = MAX(size / (size_t)w->pool->nthreads, 2 * (size_t)SORT_PARALLEL_CUTOFF);
+  p->rng = 0x9E3779B97F4A7C15ULL ^ (uint64_t)size;
+  sort_group_init(w, &p->group);
+  PARALLEL_SAMPLE_SORT_STEP(w, p, dst, size, 64 - CLZ(size)); /* ~lg N */
+  sort_group_wait(w, &p->group);
+  sort_ctx_end(w);
+
+  for (i = 0; i < SAMPLE_SORT_MAX_BUCKETS; i++) {
+    SORT_LOCK_DESTROY(&p->locks[i]);
+  }
+
+  free(p->counts);
+  free(p->buffers);
+  free(p);
+  SORT_DELETE_BUFFER(memory);
+}
+
+#ifdef SORT_PRIMITIVE
+
+/* Parallel radix sort: every chunk counts its own histograms, and a prefix sum
+   over (value, chunk) tells each chunk exactly where its elements of every byte
+   value go, so all chunks scatter at once without touching each other's output. */
+typedef struct {
+  SORT_TYPE *src;
+  SORT_TYPE *out;
+  size_t size;
+  unsigned digit;
+  size_t *counts;  /* per chunk: a histogram for every byte, or just for digit */
+  size_t *offsets; /* per chunk: where the next element of every value goes */
+} PARALLEL_RADIX_SORT_T;
+
+static void PARALLEL_RADIX_SORT_COUNT_ALL(sort_worker *w, void *data, size_t chunk,
+    size_t chunks) {
+  PARALLEL_RADIX_SORT_T *r = (PARALLEL_RADIX_SORT_T *)data;
+  (void)w;
+  RADIX_SORT_HISTOGRAM(r->src, chunk * r->size / chunks, (chunk + 1) * r->size / chunks,
+                       r->counts + chunk * sizeof(SORT_TYPE) * 256);
+}
+
+static void PARALLEL_RADIX_SORT_COUNT(sort_worker *w, void *data, size_t chunk, size_t chunks) {
+  PARALLEL_RADIX_SORT_T *r = (PARALLEL_RADIX_SORT_T *)data;
+  size_t *count = r->counts + (chunk * sizeof(SORT_TYPE) + r->digit) * 256;
+  const size_t end = (chunk + 1) * r->size / chunks;
+  const unsigned shift = 8 * r->digit;
+  size_t i;
+  (void)w;
+  memset(count, 0, 256 * sizeof(size_t));
+
+  for (i = chunk * r->size / chunks; i < end; i++) {
+    count[(RADIX_SORT_KEY(r->src[i]) >> shift) & 255]++;
+  }
+}
+
+static void PARALLEL_RADIX_SORT_SCATTER(sort_worker *w, void *data, size_t chunk,
+                                        size_t chunks) {
+  PARALLEL_RADIX_SORT_T *r = (PARALLEL_RADIX_SORT_T *)data;
+  (void)w;
+  RADIX_SORT_SCATTER(r->src, r->out, chunk * r->size / chunks, (chunk + 1) * r->size / chunks,
+                     r->digit, r->offsets + chunk * 256);
+}
+
+SORT_DEF void PARALLEL_RADIX_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx) {
+  PARALLEL_RADIX_SORT_T r;
+  SORT_TYPE *buffer, *tmp;
+  sort_worker *w;
+  size_t chunks, i, c, sum;
+  unsigned d;
+  int counted = 1;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size) || (sort_ctx_chunks(ctx, size) < 2) ||
+      !(SORT_RADIX_INTEGER || SORT_RADIX_FLOAT)) {
+    RADIX_SORT(dst, size);
+    return;
+  }
+
+  w = sort_ctx_begin(ctx);
+  chunks = sort_parallel_chunks(w, size);
+
+  buffer = SORT_NEW_BUFFER(size);
+  r.counts = (size_t *)malloc(chunks * sizeof(SORT_TYPE) * 256 * sizeof(size_t));
+  r.offsets = (size_t *)malloc(chunks * 256 * sizeof(size_t));
+
+  if ((buffer == NULL) || (r.counts == NULL) || (r.offsets == NULL)) {
+    fprintf(stderr, "Error allocating temporary storage for parallel radix sort: need %lu bytes",
+            (unsigned long)(sizeof(SORT_TYPE) * size));
+    exit(1);
+  }
+
+  r.src = dst;
+  r.out = buffer;
+  r.size = size;
+  sort_parallel_for(w, PARALLEL_RADIX_SORT_COUNT_ALL, &r, chunks);
+
+  for (d = 0; d < sizeof(SORT_TYPE); d++) {
+    size_t total[256];
+    int constant = 0;
+    memset(total, 0, sizeof(total));
+
+    /* the totals don't depend on where the elements are, so the first pass tells
+       us which bytes to skip */
+    for (c = 0; c < chunks; c++) {
+      for (i = 0; i < 256; i++) {
+        total[i] += r.counts[(c * sizeof(SORT_TYPE) + d) * 256 + i];
+      }
+    }
+
+    for (i = 0; i < 256; i++) {
+      constant |= total[i] == size;
+    }
+
+    if (constant) {
+      continue;
+    }
+
+    r.digit = d;
+
+    /* the chunks' own counts are only good until the first scatter */
+    if (!counted) {
+      sort_parallel_for(w, PARALLEL_RADIX_SORT_COUNT, &r, chunks);
+    }
+
+    counted = 0;
+    sum = 0;
+
+    for (i = 0; i < 256; i++) {
+      for (c = 0; c < chunks; c++) {
+        r.offsets[c * 256 + i] = sum;
+        sum += r.counts[(c * sizeof(SORT_TYPE) + d) * 256 + i];
+      }
+    }
+
+    sort_parallel_for(w, PARALLEL_RADIX_SORT_SCATTER, &r, chunks);
+    tmp = r.src;
+    r.src = r.out;
+    r.out = tmp;
+  }
+
+  if (r.src != dst) {
+    PARALLEL_MERGE_T m;
+    m.a = r.src;
+    m.na = size;
+    m.out = dst;
+    sort_parallel_for(w, PARALLEL_COPY_PIECE, &m, chunks);
+  }
+
+  sort_ctx_end(w);
+  free(r.offsets);
+  free(r.counts);
+  SORT_DELETE_BUFFER(buffer);
+}
+
+#endif /* SORT_PRIMITIVE */
+
+#ifdef SORT_STRING
+
+/* Parallel string sort: the words are loaded chunk by chunk, then every part of a
+   multikey quicksort partition that is too big to sort alone goes to the pool, with
+   the depth its strings agree up to riding along in a small task of its own. */
+typedef struct {
+  SORT_TYPE *dst;
+  uint64_t *cache;
+  size_t *lcp;
+  size_t size;
+  sort_group group;
+} PARALLEL_STRING_SORT_T;
+
+typedef struct {
+  PARALLEL_STRING_SORT_T *s;
+  size_t depth;
+} PARALLEL_STRING_SORT_TASK_T;
+
+static void PARALLEL_STRING_SORT_RANGE(sort_worker *w, PARALLEL_STRING_SORT_T *s,
+                                       size_t left, size_t right, size_t depth);
+
+static void PARALLEL_STRING_SORT_LOAD(sort_worker *w, void *data, size_t chunk, size_t chunks) {
+  PARALLEL_STRING_SORT_T *s = (PARALLEL_STRING_SORT_T *)data;
+  const size_t begin = chunk * s->size / chunks;
+  const size_t end = (chunk + 1) * s->size / chunks;
+  (void)w;
+  STRING_SORT_LOAD(s->dst + begin, s->cache + begin, end - begin, 0);
+}
+
+static void PARALLEL_STRING_SORT_TASK(sort_worker *w, void *data, size_t left, size_t right) {
+  PARALLEL_STRING_SORT_TASK_T *t = (PARALLEL_STRING_SORT_TASK_T *)data;
+  PARALLEL_STRING_SORT_T *s = t->s;
+  const size_t depth = t->depth;
+  free(t);
+  PARALLEL_STRING_SORT_RANGE(w, s, left, right, depth);
+}
+
+/* Sort [left, right) on another worker if it's worth it, or right here. */
+static void PARALLEL_STRING_SORT_SPAWN(sort_worker *w, PARALLEL_STRING_SORT_T *s,
+                                       const size_t left, const size_t right, const size_t depth) {
+  PARALLEL_STRING_SORT_TASK_T *t = NULL;
+
+  if (right - left > SORT_PARALLEL_CUTOFF) {
+    t = (PARALLEL_STRING_SORT_TASK_T *)malloc(sizeof(PARALLEL_STRING_SORT_TASK_T));
+  }
+
+  if (t == NULL) {
+    PARALLEL_STRING_SORT_RANGE(w, s, left, right, depth);
+    return;
+  }
+
+  t->s = s;
+  t->depth = depth;
+  sort_spawn(w, &s->group, PARALLEL_STRING_SORT_TASK, t, left, right);
+}
+
+/* The same loop as STRING_SORT_MKQS, with the smaller parts spawned. */
+static void PARALLEL_STRING_SORT_RANGE(sort_worker *w, PARALLEL_STRING_SORT_T *s,
+                                       size_t left, size_t right, size_t depth) {
+  size_t lt, gt;
+
+  while (right - left > SORT_PARALLEL_CUTOFF) {
+    const int equal_left = STRING_SORT_PARTITION(s->dst + left, s->cache + left, right - left,
+                           depth, s->lcp ? s->lcp + left : NULL, &lt, &gt);
+    const size_t eq = equal_left ? gt - lt : 0;
+    const size_t more = right - left - gt;
+    lt += left;
+    gt += left;
+
+    if (equal_left) {
+      STRING_SORT_LOAD(s->dst + lt, s->cache + lt, eq, depth + 8);
+    }
+
+    if ((lt - left >= eq) && (lt - left >= more)) {
+      PARALLEL_STRING_SORT_SPAWN(w, s, lt, lt + eq, depth + 8);
+      PARALLEL_STRING_SORT_SPAWN(w, s, gt, right, depth);
+      right = lt;
+    } else if (eq >= more) {
+      PARALLEL_STRING_SORT_SPAWN(w, s, left, lt, depth);
+      PARALLEL_STRING_SORT_SPAWN(w, s, gt, right, depth);
+      left = lt;
+      right = lt + eq;
+      depth += 8;
+    } else {
+      PARALLEL_STRING_SORT_SPAWN(w, s, left, lt, depth);
+      PARALLEL_STRING_SORT_SPAWN(w, s, lt, lt + eq, depth + 8);
+      left = gt;
+    }
+  }
+
+  STRING_SORT_MKQS(s->dst + left, s->cache + left, right - left, depth,
+                   s->lcp ? s->lcp + left : NULL);
+}
+
+SORT_DEF void PARALLEL_STRING_SORT_LCP(SORT_TYPE *dst, const size_t size, size_t *lcp,
+                                       sort_ctx *ctx) {
+  PARALLEL_STRING_SORT_T s;
+  sort_worker *w;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size)) {
+    STRING_SORT_LCP(dst, size, lcp);
+    return;
+  }
+
+  s.cache = (uint64_t *)malloc(size * sizeof(uint64_t));
+
+  if (s.cache == NULL) {
+    fprintf(stderr, "Error allocating temporary storage for parallel string sort: need %lu bytes",
+            (unsigned long)(size * sizeof(uint64_t)));
+    exit(1);
+  }
+
+  if (lcp != NULL) {
+    lcp[0] = 0;
+  }
+
+  w = sort_ctx_begin(ctx);
+  s.dst = dst;
+  s.lcp = lcp;
+  s.size = size;
+  sort_group_init(w, &s.group);
+  sort_parallel_for(w, PARALLEL_STRING_SORT_LOAD, &s, MAX(sort_parallel_chunks(w, size), 1));
+  PARALLEL_STRING_SORT_RANGE(w, &s, 0, size, 0);
+  sort_group_wait(w, &s.group);
+  sort_ctx_end(w);
+  free(s.cache);
+}
+
+SORT_DEF void PARALLEL_STRING_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx) {
+  PARALLEL_STRING_SORT_LCP(dst, size, NULL, ctx);
+}
+
+#endif /* SORT_STRING */
+
+/* Parallel shell sort: at each gap the inc chains don't touch each other, so while
+   there are plenty of them every chunk sorts its own range of chains in place; once
+   the gap gets small the rest is done on the calling thread.  Needs no memory. */
+typedef struct {
+  SORT_TYPE *dst;
+  size_t size;
+  size_t inc;
+} PARALLEL_SHELL_SORT_T;
+
+static void PARALLEL_SHELL_SORT_CHUNK(sort_worker *w, void *data, size_t chunk, size_t chunks) {
+  PARALLEL_SHELL_SORT_T *s = (PARALLEL_SHELL_SORT_T *)data;
+  (void)w;
+  SHELL_SORT_PASS(s->dst, s->size, s->inc, chunk * s->inc / chunks, (chunk + 1) * s->inc / chunks);
+}
+
+SORT_DEF void PARALLEL_SHELL_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx) {
+  PARALLEL_SHELL_SORT_T s;
+  sort_worker *w;
+  size_t chunks;
+  int inci = 47;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size) || (sort_ctx_chunks(ctx, size) < 2)) {
+    SHELL_SORT(dst, size);
+    return;
+  }
+
+  w = sort_ctx_begin(ctx);
+  chunks = sort_parallel_chunks(w, size);
+  s.dst = dst;
+  s.size = size;
+  s.inc = shell_gaps[inci];
+
+  while (s.inc > (size >> 1)) {
+    s.inc = shell_gaps[--inci];
+  }
+
+  while ((chunks >= 2) && (s.inc >= chunks * SORT_PARALLEL_SHELL_CHAINS)) {
+    sort_parallel_for(w, PARALLEL_SHELL_SORT_CHUNK, &s, chunks);
+    s.inc = shell_gaps[--inci];
+  }
+
+  sort_ctx_end(w);
+
+  while (1) {
+    SHELL_SORT_PASS(dst, size, s.inc, 0, s.inc);
+
+    if (s.inc == 1) {
+      break;
+    }
+
+    s.inc = shell_gaps[--inci];
+  }
+}
+
+/* Parallel segmented sort: the segments are cut into runs holding about the same
+   number of elements, and every chunk sorts its own run like the serial version. */
+typedef struct {
+  SORT_TYPE *data;
+  const size_t *offsets;
+  size_t nsegments;
+  int stable;
+} PARALLEL_SEGMENTED_SORT_T;
+
+/* The first segment that starts at or after chunk's share of the elements. */
+static size_t PARALLEL_SEGMENTED_SORT_FIRST(const PARALLEL_SEGMENTED_SORT_T *s,
+    const size_t chunk, const size_t chunks) {
+  const size_t total = s->offsets[s->nsegments] - s->offsets[0];
+  const size_t target = s->offsets[0] + chunk * total / chunks;
+  size_t lo = 0;
+  size_t hi = s->nsegments;
+
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+
+    if (s->offsets[mid] < target) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+static void PARALLEL_SEGMENTED_SORT_CHUNK(sort_worker *w, void *data, size_t chunk,
+    size_t chunks) {
+  PARALLEL_SEGMENTED_SORT_T *s = (PARALLEL_SEGMENTED_SORT_T *)data;
+  const size_t first = PARALLEL_SEGMENTED_SORT_FIRST(s, chunk, chunks);
+  const size_t last = (chunk + 1 == chunks) ? s->nsegments :
+                      PARALLEL_SEGMENTED_SORT_FIRST(s, chunk + 1, chunks);
+  SORT_TYPE *buffer = NULL;
+  (void)w;
+
+  if (s->stable) {
+    buffer = SEGMENTED_SORT_NEW_BUFFER(s->offsets, first, last);
+  }
+
+  SEGMENTED_SORT_RANGE(s->data, s->offsets, first, last, s->stable, buffer);
+
+  if (buffer != NULL) {
+    SORT_DELETE_BUFFER(buffer);
+  }
+}
+
+static void PARALLEL_SEGMENTED_SORT_RUN(SORT_TYPE *data, const size_t *offsets,
+                                        const size_t nsegments, const int stable, sort_ctx *ctx) {
+  PARALLEL_SEGMENTED_SORT_T s;
+  sort_worker *w;
+  size_t chunks;
+
+  /* don't bother spinning up threads for a small array */
+  if ((nsegments < 2) || sort_ctx_serial(ctx, offsets[nsegments] - offsets[0]) ||
+      (sort_ctx_chunks(ctx, offsets[nsegments] - offsets[0]) < 2)) {
+    if (stable) {
+      STABLE_SEGMENTED_SORT(data, offsets, nsegments);
+    } else {
+      SEGMENTED_SORT(data, offsets, nsegments);
+    }
+
+    return;
+  }
+
+  w = sort_ctx_begin(ctx);
+  chunks = sort_parallel_chunks(w, offsets[nsegments] - offsets[0]);
+  s.data = data;
+  s.offsets = offsets;
+  s.nsegments = nsegments;
+  s.stable = stable;
+  sort_parallel_for(w, PARALLEL_SEGMENTED_SORT_CHUNK, &s, chunks);
+  sort_ctx_end(w);
+}
+
+SORT_DEF void PARALLEL_SEGMENTED_SORT(SORT_TYPE *data, const size_t *offsets,
+                                      const size_t nsegments, sort_ctx *ctx) {
+  PARALLEL_SEGMENTED_SORT_RUN(data, offsets, nsegments, 0, ctx);
+}
+
+SORT_DEF void PARALLEL_STABLE_SEGMENTED_SORT(SORT_TYPE *data, const size_t *offsets,
+    const size_t nsegments, sort_ctx *ctx) {
+  PARALLEL_SEGMENTED_SORT_RUN(data, offsets, nsegments, 1, ctx);
+}
+
+/* Parallel top k: every chunk finds the best k of its own shard, then the best k
+   of those candidates are picked and sorted. */
+typedef struct {
+  SORT_TYPE *src;
+  size_t size;
+  size_t k;
+  SORT_TYPE *candidates; /* k per chunk */
+  SORT_TYPE *buffers;    /* 2k per chunk */
+  size_t found[SORT_PARALLEL_MAX_CHUNKS];
+} PARALLEL_TOP_K_T;
+
+static void PARALLEL_TOP_K_CHUNK(sort_worker *w, void *data, size_t chunk, size_t chunks) {
+  PARALLEL_TOP_K_T *t = (PARALLEL_TOP_K_T *)data;
+  const size_t begin = chunk * t->size / chunks;
+  const size_t end = (chunk + 1) * t->size / chunks;
+  (void)w;
+  t->found[chunk] = TOP_K_UNSORTED(t->src + begin, end - begin, t->k,
+                                   t->candidates + chunk * t->k, t->buffers + chunk * 2 * t->k);
+}
+
+SORT_DEF size_t PARALLEL_TOP_K(SORT_TYPE *src, const size_t size, const size_t k,
+                               SORT_TYPE *out, sort_ctx *ctx) {
+  PARALLEL_TOP_K_T t;
+  sort_worker *w;
+  size_t chunks, i, total, found;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size) || (sort_ctx_chunks(ctx, size) < 2) || (k == 0) ||
+      (size <= k)) {
+    return TOP_K(src, size, k, out);
+  }
+
+  w = sort_ctx_begin(ctx);
+  chunks = sort_parallel_chunks(w, size);
+
+  t.src = src;
+  t.size = size;
+  t.k = k;
+  t.candidates = SORT_NEW_BUFFER(3 * k * chunks);
+
+  if (t.candidates == NULL) {
+    fprintf(stderr, "Error allocating temporary storage for parallel top k: need %lu bytes",
+            (unsigned long)(sizeof(SORT_TYPE) * 3 * k * chunks));
+    exit(1);
+  }
+
+  t.buffers = t.candidates + k * chunks;
+  sort_parallel_for(w, PARALLEL_TOP_K_CHUNK, &t, chunks);
+  sort_ctx_end(w);
+  total = t.found[0];
+
+  for (i = 1; i < chunks; i++) {
+    SORT_TYPE_MOVE(t.candidates + total, t.candidates + i * k, t.found[i]);
+    total += t.found[i];
+  }
+
+  found = TOP_K_UNSORTED(t.candidates, total, k, out, t.buffers);
+  QUICK_SORT(out, found);
+  SORT_DELETE_BUFFER(t.candidates);
+  return found;
+}
+
+/* Parallel nth element: while the range is big, the Floyd-Rivest pivot is picked
+   serially from its small sample and the pool partitions the range; only the side
+   holding nth is kept, and the rest is done by NTH_ELEMENT_RANGE. */
+SORT_DEF void PARALLEL_NTH_ELEMENT(SORT_TYPE *dst, const size_t size, const size_t nth,
+                                   sort_ctx *ctx) {
+  sort_worker *w;
+  size_t left = 0, right, lo, hi, new_pivot;
+  int loop_count = 0;
+  int max_loops;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size) || (nth >= size)) {
+    NTH_ELEMENT(dst, size, nth);
+    return;
+  }
+
+  w = sort_ctx_begin(ctx);
+  right = size - 1U;
+  max_loops = 64 - CLZ(size); /* ~lg N */
+
+  while (right - left + 1U > MAX(SORT_PARALLEL_CUTOFF, SORT_SELECT_SAMPLE)) {
+    if (++loop_count >= max_loops) {
+      break;
+    }
+
+    sort_select_sample(right - left + 1U, nth - left, &lo, &hi);
+    NTH_ELEMENT_RANGE(dst, left + lo, left + hi, nth, 0);
+    new_pivot = PARALLEL_PARTITION(w, dst, left, right, nth);
+
+    /* check for partition all equal */
+    if ((new_pivot == SIZE_MAX) || (new_pivot == nth)) {
+      sort_ctx_end(w);
+      return;
+    }
+
+    if (nth < new_pivot) {
+      right = new_pivot - 1U;
+    } else {
+      left = new_pivot + 1U;
+    }
+  }
+
+  sort_ctx_end(w);
+  NTH_ELEMENT_RANGE(dst, left, right, nth, loop_count >= max_loops);
+}
+
+/* Parallel k-way merge: the output is cut into equal slices, and for every cut
+   each input's share of what comes before it is found by multi-sequence co-ranking,
+   so every slice is an independent k-way merge of pieces of the inputs. */
+typedef struct {
+  SORT_TYPE **inputs;
+  const size_t *lens;
+  size_t k;
+  size_t total;
+  SORT_TYPE *out;
+  size_t *splits;      /* (pieces + 1) rows of k: where each input is cut */
+  size_t *scratch;     /* pieces rows of 2k: room for the search, then each
+                          slice's input lengths */
+  SORT_TYPE **starts;  /* pieces rows of k: the inputs of each slice's merge */
+} PARALLEL_KWAY_MERGE_T;
+
+/* Find how many of each input's elements are among the first rank of the merged
+   output, into split[0, k), in the order KWAY_MERGE_LESS would take them.  A
+   random pivot out of what is still undecided tells us, after a binary search
+   in every input, on which side of the cut it lies, which settles at least the
+   pivot and, on average, a good share of everything else. */
+static void PARALLEL_KWAY_MERGE_SPLIT(SORT_TYPE **inputs, const size_t *lens, const size_t k,
+                                      const size_t rank, size_t *split, size_t *hi,
+                                      size_t *count) {
+  uint64_t rng = 0x9E3779B97F4A7C15ULL ^ (uint64_t)rank;
+  size_t undecided = 0;
+  size_t i, j;
+
+  for (i = 0; i < k; i++) {
+    split[i] = 0;
+    hi[i] = lens[i];
+    undecided += lens[i];
+  }
+
+  while (undecided > 0) {
+    size_t pick, m, below = 0;
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    pick = (size_t)(rng % undecided);
+
+    for (i = 0; pick >= hi[i] - split[i]; i++) {
+      pick -= hi[i] - split[i];
+    }
+
+    m = split[i] + pick;
+
+    /* count[j]: how many of input j come before the pivot, searching only what
+       is still undecided there */
+    for (j = 0; j < k; j++) {
+      size_t lo = split[j];
+      size_t h = hi[j];
+
+      if (j == i) {
+        count[j] = m;
+        below += m;
+        continue;
+      }
+
+      while (lo < h) {
+        const size_t mid = lo + ((h - lo) >> 1);
+        const int cmp = SORT_CMP(inputs[j][mid], inputs[i][m]);
+
+        if ((cmp < 0) || ((cmp == 0) && (j < i))) {
+          lo = mid + 1;
+        } else {
+          h = mid;
+        }
+      }
+
+      count[j] = lo;
+      below += lo;
+    }
+
+    if (below < rank) {
+      /* the pivot and everything before it are in */
+      count[i] = m + 1;
+
+      for (j = 0; j < k; j++) {
+        undecided -= count[j] - split[j];
+        split[j] = count[j];
+      }
+    } else {
+      for (j = 0; j < k; j++) {
+        undecided -= hi[j] - count[j];
+        hi[j] = count[j];
+      }
+    }
+  }
+}
+
+static void PARALLEL_KWAY_MERGE_CUT(sort_worker *w, void *data, size_t piece, size_t pieces) {
+  PARALLEL_KWAY_MERGE_T *p = (PARALLEL_KWAY_MERGE_T *)data;
+  const size_t k = p->k;
+  size_t i;
+  (void)w;
+
+  if (piece == 0) {
+    for (i = 0; i < k; i++) {
+      p->splits[i] = 0;
+      p->splits[pieces * k + i] = p->lens[i];
+    }
+
+    return;
+  }
+
+  PARALLEL_KWAY_MERGE_SPLIT(p->inputs, p->lens, k, piece * p->total / pieces,
+                            p->splits + piece * k, p->scratch + piece * 2 * k,
+                            p->scratch + piece * 2 * k + k);
+}
+
+static void PARALLEL_KWAY_MERGE_PIECE(sort_worker *w, void *data, size_t piece, size_t pieces) {
+  PARALLEL_KWAY_MERGE_T *p = (PARALLEL_KWAY_MERGE_T *)data;
+  const size_t k = p->k;
+  const size_t *begin = p->splits + piece * k;
+  const size_t *end = begin + k;
+  SORT_TYPE **starts = p->starts + piece * k;
+  size_t *lens = p->scratch + piece * 2 * k;
+  size_t i;
+  (void)w;
+
+  for (i = 0; i < k; i++) {
+    starts[i] = p->inputs[i] + begin[i];
+    lens[i] = end[i] - begin[i];
+  }
+
+  KWAY_MERGE(starts, lens, k, p->out + piece * p->total / pieces);
+}
+
+SORT_DEF void PARALLEL_KWAY_MERGE(SORT_TYPE **inputs, const size_t *lens, const size_t k,
+                                  SORT_TYPE *out, sort_ctx *ctx) {
+  PARALLEL_KWAY_MERGE_T p;
+  sort_worker *w;
+  size_t pieces, i;
+
+  p.total = 0;
+
+  for (i = 0; i < k; i++) {
+    p.total += lens[i];
+  }
+
+  /* don't bother spinning up threads for a small output */
+  if (sort_ctx_serial(ctx, p.total) || (sort_ctx_chunks(ctx, p.total) < 2) || (k < 2)) {
+    KWAY_MERGE(inputs, lens, k, out);
+    return;
+  }
+
+  w = sort_ctx_begin(ctx);
+  pieces = sort_parallel_chunks(w, p.total);
+
+  p.inputs = inputs;
+  p.lens = lens;
+  p.k = k;
+  p.out = out;
+  p.splits = (size_t *)malloc((3 * pieces + 1) * k * sizeof(size_t));
+  p.starts = (SORT_TYPE **)malloc(pieces * k * sizeof(SORT_TYPE *));
+
+  if ((p.splits == NULL) || (p.starts == NULL)) {
+    fprintf(stderr, "Error allocating temporary storage for parallel k-way merge");
+    exit(1);
+  }
+
+  p.scratch = p.splits + (pieces + 1) * k;
+  sort_parallel_for(w, PARALLEL_KWAY_MERGE_CUT, &p, pieces);
+  sort_parallel_for(w, PARALLEL_KWAY_MERGE_PIECE, &p, pieces);
+  sort_ctx_end(w);
+  free(p.starts);
+  free(p.splits);
+}
+
+#ifdef SORT_EXTRA
+
+/* sort_extra.h cleans up its names, so bring back the ones used here. */
+#define GRAIL_SORT                     SORT_MAKE_STR(grail_sort)
+#define GRAIL_REC_MERGE                SORT_MAKE_STR(grail_rec_merge)
+
+/* Parallel grail sort: the pieces are grail sorted concurrently and then merged
+   back together in place, so every thread still needs only O(1) extra memory.
+   A big merge is cut in two at the middle of its output by co-ranking, and the
+   two middle parts are rotated past each other; the halves are then independent
+   merges which run as separate tasks.  Ties always keep their original order. */
+typedef struct {
+  SORT_TYPE *dst;
+  size_t size;
+  size_t split;
+} PARALLEL_GRAIL_SORT_T;
+
+/* Reverse dst[0, size) with every piece swapping its own share of the pairs. */
+static void PARALLEL_GRAIL_REVERSE_PIECE(sort_worker *w, void *data, size_t piece,
+    size_t pieces) {
+  PARALLEL_GRAIL_SORT_T *g = (PARALLEL_GRAIL_SORT_T *)data;
+  const size_t half = g->size / 2;
+  const size_t end = (piece + 1) * half / pieces;
+  size_t i;
+  (void)w;
+
+  for (i = piece * half / pieces; i < end; i++) {
+    SORT_SWAP(g->dst[i], g->dst[g->size - 1 - i]);
+  }
+}
+
+static void PARALLEL_GRAIL_REVERSE(sort_worker *w, SORT_TYPE *dst, const size_t size) {
+  PARALLEL_GRAIL_SORT_T g;
+  g.dst = dst;
+  g.size = size;
+  sort_parallel_for(w, PARALLEL_GRAIL_REVERSE_PIECE, &g, MAX((size_t)1, sort_parallel_chunks(w, size)));
+}
+
+static void PARALLEL_GRAIL_MERGE_TASK(sort_worker *w, void *data, size_t begin, size_t end);
+
+/* Stable in-place merge of the sorted runs dst[0, l1) and dst[l1, l1 + l2). */
+static void PARALLEL_GRAIL_MERGE(sort_worker *w, SORT_TYPE *dst, const size_t l1,
+                                 const size_t l2) {
+  PARALLEL_GRAIL_SORT_T left;
+  sort_group group;
+  const size_t half = (l1 + l2) / 2;
+  size_t i, j;
+
+  if ((l1 == 0) || (l2 == 0)) {
+    return;
+  }
+
+  if (l1 + l2 <= SORT_PARALLEL_CUTOFF) {
+    GRAIL_REC_MERGE(dst, (int)l1, (int)l2);
+    return;
+  }
+
+  /* the first half of the output is dst[0, i) and dst[l1, l1 + j) */
+  i = MERGE_CO_RANK(half, dst, l1, dst + l1, l2);
+  j = half - i;
+
+  /* rotate dst[i, l1) past dst[l1, l1 + j) */
+  if ((i < l1) && (j > 0)) {
+    PARALLEL_GRAIL_REVERSE(w, dst + i, l1 - i);
+    PARALLEL_GRAIL_REVERSE(w, dst + l1, j);
+    PARALLEL_GRAIL_REVERSE(w, dst + i, l1 - i + j);
+  }
+
+  left.dst = dst;
+  left.size = half;
+  left.split = i;
+  sort_group_init(w, &group);
+  sort_spawn(w, &group, PARALLEL_GRAIL_MERGE_TASK, &left, 0, 0);
+  PARALLEL_GRAIL_MERGE(w, dst + half, l1 - i, l2 - j);
+  sort_group_wait(w, &group);
+}
+
+static void PARALLEL_GRAIL_MERGE_TASK(sort_worker *w, void *data, size_t begin, size_t end) {
+  PARALLEL_GRAIL_SORT_T *g = (PARALLEL_GRAIL_SORT_T *)data;
+  (void)begin;
+  (void)end;
+  PARALLEL_GRAIL_MERGE(w, g->dst, g->split, g->size - g->split);
+}
+
+/* Sort dst[begin, end): grail sort small enough pieces, merge the rest. */
+static void PARALLEL_GRAIL_SORT_TASK(sort_worker *w, void *data, size_t begin, size_t end) {
+  PARALLEL_GRAIL_SORT_T *g = (PARALLEL_GRAIL_SORT_T *)data;
+  const size_t middle = begin + ((end - begin) >> 1);
+  sort_group group;
+
+  /* g->size is the size of the pieces we stop splitting at */
+  if (end - begin <= g->size) {
+    GRAIL_SORT(g->dst + begin, end - begin);
+    return;
+  }
+
+  sort_group_init(w, &group);
+  sort_spawn(w, &group, PARALLEL_GRAIL_SORT_TASK, g, begin, middle);
+  PARALLEL_GRAIL_SORT_TASK(w, g, middle, end);
+  sort_group_wait(w, &group);
+  PARALLEL_GRAIL_MERGE(w, g->dst + begin, middle - begin, end - middle);
+}
+
+SORT_DEF void PARALLEL_GRAIL_SORT(SORT_TYPE *dst, const size_t size, sort_ctx *ctx) {
+  PARALLEL_GRAIL_SORT_T g;
+  sort_worker *w;
+
+  /* don't bother spinning up threads for a small array */
+  if (sort_ctx_serial(ctx, size)) {
+    GRAIL_SORT(dst, size);
+    return;
+  }
+
+  w = sort_ctx_begin(ctx);
+  g.dst = dst;
+  g.size = MAX((size + (size_t)w->pool->nthreads - 1) / (size_t)w->pool->nthreads,
+               (size_t)SORT_PARALLEL_CUTOFF);
+  PARALLEL_GRAIL_SORT_TASK(w, &g, 0, size);
+  sort_ctx_end(w);
+}
+
+#endif /* SORT_EXTRA */
@@ -0,0 +1,1293 @@
+/* Copyright (c) 2010-2024 Christopher Swenson. */
+/* Copyright (c) 2012 Google Inc. All Rights Reserved. */
+
+/* SIMD kernels for SORT_PRIMITIVE types, included by sort.h.
+
+   The kernels work on the bits of the keys, so there is one of each for 32-bit and
+   one for 64-bit keys rather than one per SORT_TYPE: unsigned and floating-point
+   keys are turned into signed integers that compare the same way as they are
+   loaded, and turned back as they are stored.  For floating point that is the
+   IEEE-754 total order, so -0.0 goes before 0.0 and NaNs end up at the ends rather
+   than being lost among the padding.
+
+   On x86 with GCC or clang every kernel is built for SSE4.2, AVX2 and AVX-512,
+   whatever the compiler flags: this file includes itself once for each of them,
+   much as sort.h is included once per type, and each copy has that target.  The
+   first call asks the CPU which of them it has and keeps the answer, so the same
+   binary runs the best kernels each machine can.  Set the environment variable
+   SORT_SIMD to scalar, sse4.2 or avx2 to go no further than that, or call
+   sort_simd_use; define SORT_SIMD to 0 to leave the kernels out altogether. */
+
+#ifndef SORT_SIMD_ISA
+
+#ifndef SORT_SIMD_H
+#define SORT_SIMD_H
+
+#ifndef SORT_SIMD
+#define SORT_SIMD 1
+#endif
+
+#if SORT_SIMD && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 6)))
+#define SORT_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define SORT_SIMD_X86 0
+#endif
+
+/* What the SIMD kernels take a SORT_PRIMITIVE type for (see SORT_SIMD_KIND). */
+#define SORT_SIMD_NONE 0
+#define SORT_SIMD_I32  1
+#define SORT_SIMD_U32  2
+#define SORT_SIMD_F32  3
+#define SORT_SIMD_I64  4
+#define SORT_SIMD_U64  5
+#define SORT_SIMD_F64  6
+
+/* The instruction sets there are kernels for, worst first. */
+#define SORT_SIMD_SCALAR 0
+#define SORT_SIMD_SSE42  1
+#define SORT_SIMD_AVX2   2
+#define SORT_SIMD_AVX512 3
+
+/* Sorting networks only pay off from this many keys; the most keys they hold is
+   8 registers' worth. */
+#define SORT_SIMD_NETWORK_MIN 8
+
+/* Partitioning a vector at a time only pays off from this many keys, and it works
+   on SORT_SIMD_UNROLL vectors at once. */
+#define SORT_SIMD_PARTITION_MIN 64
+#define SORT_SIMD_UNROLL 4
+
+/* Merging takes this many registers from a list at a time, and needs that many
+   keys in both lists to start. */
+#define SORT_SIMD_MERGE_UNROLL 2
+
+#if SORT_SIMD_X86
+
+/* How to move the lanes picked out by a mask in front of the rest, keeping the
+   order of each: for 8 lanes as 3-bit lane numbers, and for 4 lanes as the bytes
+   to shuffle.  Masks of 64-bit lanes have both halves of each lane set. */
+static const uint32_t sort_simd_compress8[256] = {
+  0xFAC688, 0xFAC688, 0xFAC681, 0xFAC688, 0xFAC642, 0xFAC650, 0xFAC611, 0xFAC688,
+  0xFAC443, 0xFAC458, 0xFAC419, 0xFAC4C8, 0xFAC21A, 0xFAC2D0, 0xFAC0D1, 0xFAC688,
+  0xFAB444, 0xFAB460, 0xFAB421, 0xFAB508, 0xFAB222, 0xFAB310, 0xFAB111, 0xFAB888,
+  0xFAA223, 0xFAA318, 0xFAA119, 0xFAA8C8, 0xFA911A, 0xFA98D0, 0xFA88D1, 0xFAC688,
+  0xFA3445, 0xFA3468, 0xFA3429, 0xFA3548, 0xFA322A, 0xFA3350, 0xFA3151, 0xFA3A88,
+  0xFA222B, 0xFA2358, 0xFA2159, 0xFA2AC8, 0xFA115A, 0xFA1AD0, 0xFA0AD1, 0xFA5688,
+  0xF9A22C, 0xF9A360, 0xF9A161, 0xF9AB08, 0xF99162, 0xF99B10, 0xF98B11, 0xF9D888,
+  0xF91163, 0xF91B18, 0xF90B19, 0xF958C8, 0xF88B1A, 0xF8D8D0, 0xF858D1, 0xFAC688,
+  0xF63446, 0xF63470, 0xF63431, 0xF63588, 0xF63232, 0xF63390, 0xF63191, 0xF63C88,
+  0xF62233, 0xF62398, 0xF62199, 0xF62CC8, 0xF6119A, 0xF61CD0, 0xF60CD1, 0xF66688,
+  0xF5A234, 0xF5A3A0, 0xF5A1A1, 0xF5AD08, 0xF591A2, 0xF59D10, 0xF58D11, 0xF5E888,
+  0xF511A3, 0xF51D18, 0xF50D19, 0xF568C8, 0xF48D1A, 0xF4E8D0, 0xF468D1, 0xF74688,
+  0xF1A235, 0xF1A3A8, 0xF1A1A9, 0xF1AD48, 0xF191AA, 0xF19D50, 0xF18D51, 0xF1EA88,
+  0xF111AB, 0xF11D58, 0xF10D59, 0xF16AC8, 0xF08D5A, 0xF0EAD0, 0xF06AD1, 0xF35688,
+  0xED11AC, 0xED1D60, 0xED0D61, 0xED6B08, 0xEC8D62, 0xECEB10, 0xEC6B11, 0xEF5888,
+  0xE88D63, 0xE8EB18, 0xE86B19, 0xEB58C8, 0xE46B1A, 0xE758D0, 0xE358D1, 0xFAC688,
+  0xD63447, 0xD63478, 0xD63439, 0xD635C8, 0xD6323A, 0xD633D0, 0xD631D1, 0xD63E88,
+  0xD6223B, 0xD623D8, 0xD621D9, 0xD62EC8, 0xD611DA, 0xD61ED0, 0xD60ED1, 0xD67688,
+  0xD5A23C, 0xD5A3E0, 0xD5A1E1, 0xD5AF08, 0xD591E2, 0xD59F10, 0xD58F11, 0xD5F888,
+  0xD511E3, 0xD51F18, 0xD50F19, 0xD578C8, 0xD48F1A, 0xD4F8D0, 0xD478D1, 0xD7C688,
+  0xD1A23D, 0xD1A3E8, 0xD1A1E9, 0xD1AF48, 0xD191EA, 0xD19F50, 0xD18F51, 0xD1FA88,
+  0xD111EB, 0xD11F58, 0xD10F59, 0xD17AC8, 0xD08F5A, 0xD0FAD0, 0xD07AD1, 0xD3D688,
+  0xCD11EC, 0xCD1F60, 0xCD0F61, 0xCD7B08, 0xCC8F62, 0xCCFB10, 0xCC7B11, 0xCFD888,
+  0xC88F63, 0xC8FB18, 0xC87B19, 0xCBD8C8, 0xC47B1A, 0xC7D8D0, 0xC3D8D1, 0xDEC688,
+  0xB1A23E, 0xB1A3F0, 0xB1A1F1, 0xB1AF88, 0xB191F2, 0xB19F90, 0xB18F91, 0xB1FC88,
+  0xB111F3, 0xB11F98, 0xB10F99, 0xB17CC8, 0xB08F9A, 0xB0FCD0, 0xB07CD1, 0xB3E688,
+  0xAD11F4, 0xAD1FA0, 0xAD0FA1, 0xAD7D08, 0xAC8FA2, 0xACFD10, 0xAC7D11, 0xAFE888,
+  0xA88FA3, 0xA8FD18, 0xA87D19, 0xABE8C8, 0xA47D1A, 0xA7E8D0, 0xA3E8D1, 0xBF4688,
+  0x8D11F5, 0x8D1FA8, 0x8D0FA9, 0x8D7D48, 0x8C8FAA, 0x8CFD50, 0x8C7D51, 0x8FEA88,
+  0x888FAB, 0x88FD58, 0x887D59, 0x8BEAC8, 0x847D5A, 0x87EAD0, 0x83EAD1, 0x9F5688,
+  0x688FAC, 0x68FD60, 0x687D61, 0x6BEB08, 0x647D62, 0x67EB10, 0x63EB11, 0x7F5888,
+  0x447D63, 0x47EB18, 0x43EB19, 0x5F58C8, 0x23EB1A, 0x3F58D0, 0x1F58D1, 0xFAC688,
+};
+
+static const unsigned char sort_simd_compress4[16][16] = {
+  {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+  {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+  {4, 5, 6, 7, 0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15},
+  {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+  {8, 9, 10, 11, 0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15},
+  {0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15},
+  {4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 3, 12, 13, 14, 15},
+  {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+  {12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+  {0, 1, 2, 3, 12, 13, 14, 15, 4, 5, 6, 7, 8, 9, 10, 11},
+  {4, 5, 6, 7, 12, 13, 14, 15, 0, 1, 2, 3, 8, 9, 10, 11},
+  {0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15, 8, 9, 10, 11},
+  {8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7},
+  {0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15, 4, 5, 6, 7},
+  {4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3},
+  {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+};
+
+/* The integer key at p, as a number that compares the same way. */
+static __inline long long sort_simd_key_at(const int kind, const char *p) {
+  int32_t i32;
+  uint32_t u32;
+  long long i64;
+
+  switch (kind) {
+  case SORT_SIMD_I32:
+    memcpy(&i32, p, sizeof(i32));
+    return i32;
+
+  case SORT_SIMD_U32:
+    memcpy(&u32, p, sizeof(u32));
+    return u32;
+
+  default:
+    memcpy(&i64, p, sizeof(i64));
+    return kind == SORT_SIMD_U64 ? (long long)((unsigned long long)i64 ^ 0x8000000000000000ULL) :
+           i64;
+  }
+}
+
+#define SORT_SIMD_ISA sse42
+#define SORT_SIMD_TARGET "sse4.2,popcnt"
+#define SORT_SIMD_WIDTH 128
+#define SORT_SIMD_EVEX 0
+#include "sort_simd.h"
+
+#define SORT_SIMD_ISA avx2
+#define SORT_SIMD_TARGET "avx2,popcnt"
+#define SORT_SIMD_WIDTH 256
+#define SORT_SIMD_EVEX 0
+#include "sort_simd.h"
+
+/* AVX-512 runs the AVX2 kernels with the 64-bit min and max and the mask
+   registers that AVX-512VL adds to them. */
+#define SORT_SIMD_ISA avx512
+#define SORT_SIMD_TARGET "avx2,popcnt,avx512f,avx512vl"
+#define SORT_SIMD_WIDTH 256
+#define SORT_SIMD_EVEX 1
+#include "sort_simd.h"
+
+/* The best instruction set the CPU (and the operating system) supports. */
+static int sort_simd_cpu(void) {
+  int level = SORT_SIMD_SCALAR;
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+    level = SORT_SIMD_SSE42;
+
+    if (__builtin_cpu_supports("avx2")) {
+      level = SORT_SIMD_AVX2;
+
+      if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl")) {
+        level = SORT_SIMD_AVX512;
+      }
+    }
+  }
+
+  return level;
+}
+
+/* The instruction set in use, worked out on the first call; threads racing to
+   work it out all come up with the same answer. */
+static int sort_simd_current = -1;
+
+static __inline int sort_simd_level(void) {
+  int level = __atomic_load_n(&sort_simd_current, __ATOMIC_RELAXED);
+  const char *env;
+
+  if (level < 0) {
+    level = sort_simd_cpu();
+    env = getenv("SORT_SIMD");
+
+    if (env != NULL) {
+      level = MIN(level, !strcmp(env, "scalar") ? SORT_SIMD_SCALAR :
+                  !strcmp(env, "sse4.2") ? SORT_SIMD_SSE42 :
+                  !strcmp(env, "avx2") ? SORT_SIMD_AVX2 : SORT_SIMD_AVX512);
+    }
+
+    __atomic_store_n(&sort_simd_current, level, __ATOMIC_RELAXED);
+  }
+
+  return level;
+}
+
+/* Use no better than the given instruction set from now on, and return the one
+   that is then in use, which is less if the CPU hasn't got it. */
+static __inline int sort_simd_use(const int level) {
+  const int used = MIN(level, sort_simd_cpu());
+  __atomic_store_n(&sort_simd_current, used, __ATOMIC_RELAXED);
+  return used;
+}
+
+#else
+
+static __inline int sort_simd_level(void) {
+  return SORT_SIMD_SCALAR;
+}
+
+static __inline int sort_simd_use(const int level) {
+  (void)level;
+  return SORT_SIMD_SCALAR;
+}
+
+#endif /* SORT_SIMD_X86 */
+
+/* Sort size keys of the given kind at dst with a sorting network held in
+   registers, if there is one for them; returns whether it did. */
+static __inline int sort_simd_network(const int kind, void *dst, const size_t size) {
+#if SORT_SIMD_X86
+
+  if ((kind == SORT_SIMD_NONE) || (size < SORT_SIMD_NETWORK_MIN)) {
+    return 0;
+  }
+
+  switch (sort_simd_level()) {
+  case SORT_SIMD_SSE42:
+    return sort_simd_network_sse42(kind, (char *)dst, size);
+
+  case SORT_SIMD_AVX2:
+    return sort_simd_network_avx2(kind, (char *)dst, size);
+
+  case SORT_SIMD_AVX512:
+    return sort_simd_network_avx512(kind, (char *)dst, size);
+
+  default:
+    return 0;
+  }
+
+#else
+  (void)kind;
+  (void)dst;
+  (void)size;
+  return 0;
+#endif
+}
+
+/* Partition the size keys of the given kind at dst around the key at pivot:
+   the ones less than it go in front of the rest.  Returns how many those are, or
+   SIZE_MAX if there is no kernel for them. */
+static __inline size_t sort_simd_partition(const int kind, void *dst, const size_t size,
+    const void *pivot) {
+#if SORT_SIMD_X86
+
+  if ((kind == SORT_SIMD_NONE) || (size < SORT_SIMD_PARTITION_MIN)) {
+    return SIZE_MAX;
+  }
+
+  switch (sort_simd_level()) {
+  case SORT_SIMD_SSE42:
+    return sort_simd_partition_sse42(kind, (char *)dst, size, pivot);
+
+  case SORT_SIMD_AVX2:
+    return sort_simd_partition_avx2(kind, (char *)dst, size, pivot);
+
+  case SORT_SIMD_AVX512:
+    return sort_simd_partition_avx512(kind, (char *)dst, size, pivot);
+
+  default:
+    return SIZE_MAX;
+  }
+
+#else
+  (void)kind;
+  (void)dst;
+  (void)size;
+  (void)pivot;
+  return SIZE_MAX;
+#endif
+}
+
+/* Merge the sorted keys of the given kind at a (na of them) and b (nb) into dst
+   for as long as that can be done a block of vectors at a time, front to back, or
+   back to front if back is set (then into the end of dst, from the ends of a and b).
+   Returns how many keys were merged, setting *used_a to how many came from a; it is
+   up to the caller to merge the rest.  Integer keys only: the merges in merge sort
+   and tim sort have to be stable, and floating-point keys that compare equal may
+   not be the same (-0.0 and 0.0). */
+static __inline size_t sort_simd_merge(const int kind, const int back, void *dst, const void *a,
+                                       const size_t na, const void *b, const size_t nb,
+                                       size_t *used_a) {
+#if SORT_SIMD_X86
+  const int level = sort_simd_level();
+  *used_a = 0;
+
+  if ((kind == SORT_SIMD_NONE) || (kind == SORT_SIMD_F32) || (kind == SORT_SIMD_F64) ||
+      (level == SORT_SIMD_SCALAR)) {
+    return 0;
+  }
+
+  switch (level) {
+  case SORT_SIMD_SSE42:
+    return sort_simd_merge_sse42(kind, back, (char *)dst, (const char *)a, na, (const char *)b, nb,
+                                 used_a);
+
+  case SORT_SIMD_AVX2:
+    return sort_simd_merge_avx2(kind, back, (char *)dst, (const char *)a, na, (const char *)b, nb,
+                                used_a);
+
+  default:
+    return sort_simd_merge_avx512(kind, back, (char *)dst, (const char *)a, na, (const char *)b,
+                                  nb, used_a);
+  }
+
+#else
+  (void)kind;
+  (void)back;
+  (void)dst;
+  (void)a;
+  (void)na;
+  (void)b;
+  (void)nb;
+  *used_a = 0;
+  return 0;
+#endif
+}
+
+/* The first of the size keys of the given kind at dst that is less than the one
+   before it (or, if reversed is set, that isn't), or size if none is; SIZE_MAX if
+   there is no kernel for them. */
+static __inline size_t sort_simd_sorted_until(const int kind, const void *dst, const size_t size,
+    const int reversed) {
+#if SORT_SIMD_X86
+
+  if (kind == SORT_SIMD_NONE) {
+    return SIZE_MAX;
+  }
+
+  switch (sort_simd_level()) {
+  case SORT_SIMD_SSE42:
+    return sort_simd_sorted_until_sse42(kind, (const char *)dst, size, reversed);
+
+  case SORT_SIMD_AVX2:
+    return sort_simd_sorted_until_avx2(kind, (const char *)dst, size, reversed);
+
+  case SORT_SIMD_AVX512:
+    return sort_simd_sorted_until_avx512(kind, (const char *)dst, size, reversed);
+
+  default:
+    return SIZE_MAX;
+  }
+
+#else
+  (void)kind;
+  (void)dst;
+  (void)size;
+  (void)reversed;
+  return SIZE_MAX;
+#endif
+}
+
+#endif /* SORT_SIMD_H */
+
+#else /* SORT_SIMD_ISA */
+
+/* The kernels for one instruction set: SORT_SIMD_ISA names it, SORT_SIMD_TARGET
+   is what the compiler calls it, SORT_SIMD_WIDTH is how many bits a register
+   holds, and SORT_SIMD_EVEX is whether it has AVX-512VL. */
+
+#define SORT_SIMD_CONCAT(x, y) x ## _ ## y
+#define SORT_SIMD_MAKE_STR1(x, y) SORT_SIMD_CONCAT(x, y)
+#define SORT_SIMD_MAKE_STR(x) SORT_SIMD_MAKE_STR1(x, SORT_SIMD_ISA)
+
+#define SORT_SIMD_INLINE static __inline __attribute__((target(SORT_SIMD_TARGET)))
+#define SORT_SIMD_STATIC static __attribute__((target(SORT_SIMD_TARGET), flatten))
+
+#define SORT_SIMD_KEY          SORT_SIMD_MAKE_STR(sort_simd_key)
+#define SORT_SIMD_MIN          SORT_SIMD_MAKE_STR(sort_simd_min)
+#define SORT_SIMD_MAX          SORT_SIMD_MAKE_STR(sort_simd_max)
+#define SORT_SIMD_REVERSE      SORT_SIMD_MAKE_STR(sort_simd_reverse)
+#define SORT_SIMD_SORT_LANES   SORT_SIMD_MAKE_STR(sort_simd_sort_lanes)
+#define SORT_SIMD_CLEAN_LANES  SORT_SIMD_MAKE_STR(sort_simd_clean_lanes)
+#define SORT_SIMD_MERGE_REGS   SORT_SIMD_MAKE_STR(sort_simd_merge_regs)
+#define SORT_SIMD_SORT_REGS    SORT_SIMD_MAKE_STR(sort_simd_sort_regs)
+#define SORT_SIMD_LOAD         SORT_SIMD_MAKE_STR(sort_simd_load)
+#define SORT_SIMD_STORE        SORT_SIMD_MAKE_STR(sort_simd_store)
+#define SORT_SIMD_NETWORK_REGS SORT_SIMD_MAKE_STR(sort_simd_network_regs)
+#define SORT_SIMD_NETWORK_X1   SORT_SIMD_MAKE_STR(sort_simd_network_x1)
+#define SORT_SIMD_NETWORK_X2   SORT_SIMD_MAKE_STR(sort_simd_network_x2)
+#define SORT_SIMD_NETWORK_X4   SORT_SIMD_MAKE_STR(sort_simd_network_x4)
+#define SORT_SIMD_NETWORK_X8   SORT_SIMD_MAKE_STR(sort_simd_network_x8)
+#define SORT_SIMD_NETWORKS     SORT_SIMD_MAKE_STR(sort_simd_networks)
+#define SORT_SIMD_NETWORK      SORT_SIMD_MAKE_STR(sort_simd_network)
+#define SORT_SIMD_COMPRESS     SORT_SIMD_MAKE_STR(sort_simd_compress)
+#define SORT_SIMD_KEYS         SORT_SIMD_MAKE_STR(sort_simd_keys)
+#define SORT_SIMD_LESS         SORT_SIMD_MAKE_STR(sort_simd_less)
+#define SORT_SIMD_SPLIT        SORT_SIMD_MAKE_STR(sort_simd_split)
+#define SORT_SIMD_PARTITION_KIND SORT_SIMD_MAKE_STR(sort_simd_partition_kind)
+#define SORT_SIMD_PARTITION_I32 SORT_SIMD_MAKE_STR(sort_simd_partition_i32)
+#define SORT_SIMD_PARTITION_U32 SORT_SIMD_MAKE_STR(sort_simd_partition_u32)
+#define SORT_SIMD_PARTITION_F32 SORT_SIMD_MAKE_STR(sort_simd_partition_f32)
+#define SORT_SIMD_PARTITION_I64 SORT_SIMD_MAKE_STR(sort_simd_partition_i64)
+#define SORT_SIMD_PARTITION_U64 SORT_SIMD_MAKE_STR(sort_simd_partition_u64)
+#define SORT_SIMD_PARTITION_F64 SORT_SIMD_MAKE_STR(sort_simd_partition_f64)
+#define SORT_SIMD_PARTITIONS   SORT_SIMD_MAKE_STR(sort_simd_partitions)
+#define SORT_SIMD_PARTITION    SORT_SIMD_MAKE_STR(sort_simd_partition)
+#define SORT_SIMD_MERGE_KIND   SORT_SIMD_MAKE_STR(sort_simd_merge_kind)
+#define SORT_SIMD_MERGE_BACK_KIND SORT_SIMD_MAKE_STR(sort_simd_merge_back_kind)
+#define SORT_SIMD_MERGE_32     SORT_SIMD_MAKE_STR(sort_simd_merge_32)
+#define SORT_SIMD_MERGE_64     SORT_SIMD_MAKE_STR(sort_simd_merge_64)
+#define SORT_SIMD_MERGE_BACK_32 SORT_SIMD_MAKE_STR(sort_simd_merge_back_32)
+#define SORT_SIMD_MERGE_BACK_64 SORT_SIMD_MAKE_STR(sort_simd_merge_back_64)
+#define SORT_SIMD_MERGE        SORT_SIMD_MAKE_STR(sort_simd_merge)
+#define SORT_SIMD_DESCENT      SORT_SIMD_MAKE_STR(sort_simd_descent)
+#define SORT_SIMD_SORTED_UNTIL_KIND SORT_SIMD_MAKE_STR(sort_simd_sorted_until_kind)
+#define SORT_SIMD_SORTED_UNTIL_I32 SORT_SIMD_MAKE_STR(sort_simd_sorted_until_i32)
+#define SORT_SIMD_SORTED_UNTIL_U32 SORT_SIMD_MAKE_STR(sort_simd_sorted_until_u32)
+#define SORT_SIMD_SORTED_UNTIL_F32 SORT_SIMD_MAKE_STR(sort_simd_sorted_until_f32)
+#define SORT_SIMD_SORTED_UNTIL_I64 SORT_SIMD_MAKE_STR(sort_simd_sorted_until_i64)
+#define SORT_SIMD_SORTED_UNTIL_U64 SORT_SIMD_MAKE_STR(sort_simd_sorted_until_u64)
+#define SORT_SIMD_SORTED_UNTIL_F64 SORT_SIMD_MAKE_STR(sort_simd_sorted_until_f64)
+#define SORT_SIMD_SORTED_UNTILS SORT_SIMD_MAKE_STR(sort_simd_sorted_untils)
+#define SORT_SIMD_SORTED_UNTIL SORT_SIMD_MAKE_STR(sort_simd_sorted_until)
+
+/* The same operations on registers of either width; SORT_SIMD_BLEND32 takes a
+   mask of 32-bit lanes either way. */
+#if SORT_SIMD_WIDTH == 256
+#define SORT_SIMD_V                 __m256i
+#define SORT_SIMD_LOADU(p)          _mm256_loadu_si256((const __m256i *)(p))
+#define SORT_SIMD_STOREU(p, v)      _mm256_storeu_si256((__m256i *)(p), (v))
+#define SORT_SIMD_SET1_32(x)        _mm256_set1_epi32(x)
+#define SORT_SIMD_SET1_64(x)        _mm256_set1_epi64x(x)
+#define SORT_SIMD_ZERO()            _mm256_setzero_si256()
+#define SORT_SIMD_XOR(a, b)         _mm256_xor_si256((a), (b))
+#define SORT_SIMD_OR(a, b)          _mm256_or_si256((a), (b))
+#define SORT_SIMD_AND(a, b)         _mm256_and_si256((a), (b))
+#define SORT_SIMD_SRAI32(v, n)      _mm256_srai_epi32((v), (n))
+#define SORT_SIMD_SRLI32(v, n)      _mm256_srli_epi32((v), (n))
+#define SORT_SIMD_SRLI64(v, n)      _mm256_srli_epi64((v), (n))
+#define SORT_SIMD_CMPGT32(a, b)     _mm256_cmpgt_epi32((a), (b))
+#define SORT_SIMD_CMPGT64(a, b)     _mm256_cmpgt_epi64((a), (b))
+#define SORT_SIMD_MOVEMASK32(v)     _mm256_movemask_ps(_mm256_castsi256_ps(v))
+#define SORT_SIMD_MIN32(a, b)       _mm256_min_epi32((a), (b))
+#define SORT_SIMD_MAX32(a, b)       _mm256_max_epi32((a), (b))
+#define SORT_SIMD_SHUFFLE32(v, m)   _mm256_shuffle_epi32((v), (m))
+#define SORT_SIMD_BLEND32(a, b, m)  _mm256_blend_epi32((a), (b), (m))
+#define SORT_SIMD_FCMPGT32(a, b)    _mm256_castps_si256(_mm256_cmp_ps( \
+    _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_GT_OQ))
+#define SORT_SIMD_FCMPGT64(a, b)    _mm256_castpd_si256(_mm256_cmp_pd( \
+    _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_GT_OQ))
+#define SORT_SIMD_BLENDV64(a, b, m) _mm256_castpd_si256(_mm256_blendv_pd( \
+    _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _mm256_castsi256_pd(m)))
+#else
+#define SORT_SIMD_V                 __m128i
+#define SORT_SIMD_LOADU(p)          _mm_loadu_si128((const __m128i *)(p))
+#define SORT_SIMD_STOREU(p, v)      _mm_storeu_si128((__m128i *)(p), (v))
+#define SORT_SIMD_SET1_32(x)        _mm_set1_epi32(x)
+#define SORT_SIMD_SET1_64(x)        _mm_set1_epi64x(x)
+#define SORT_SIMD_ZERO()            _mm_setzero_si128()
+#define SORT_SIMD_XOR(a, b)         _mm_xor_si128((a), (b))
+#define SORT_SIMD_OR(a, b)          _mm_or_si128((a), (b))
+#define SORT_SIMD_AND(a, b)         _mm_and_si128((a), (b))
+#define SORT_SIMD_SRAI32(v, n)      _mm_srai_epi32((v), (n))
+#define SORT_SIMD_SRLI32(v, n)      _mm_srli_epi32((v), (n))
+#define SORT_SIMD_SRLI64(v, n)      _mm_srli_epi64((v), (n))
+#define SORT_SIMD_CMPGT32(a, b)     _mm_cmpgt_epi32((a), (b))
+#define SORT_SIMD_CMPGT64(a, b)     _mm_cmpgt_epi64((a), (b))
+#define SORT_SIMD_MOVEMASK32(v)     _mm_movemask_ps(_mm_castsi128_ps(v))
+#define SORT_SIMD_MIN32(a, b)       _mm_min_epi32((a), (b))
+#define SORT_SIMD_MAX32(a, b)       _mm_max_epi32((a), (b))
+#define SORT_SIMD_SHUFFLE32(v, m)   _mm_shuffle_epi32((v), (m))
+#define SORT_SIMD_FCMPGT32(a, b)    _mm_castps_si128(_mm_cmpgt_ps( \
+    _mm_castsi128_ps(a), _mm_castsi128_ps(b)))
+#define SORT_SIMD_FCMPGT64(a, b)    _mm_castpd_si128(_mm_cmpgt_pd( \
+    _mm_castsi128_pd(a), _mm_castsi128_pd(b)))
+#define SORT_SIMD_BLEND32(a, b, m)  _mm_blend_epi16((a), (b), \
+    (((m) & 1) ? 0x03 : 0) | (((m) & 2) ? 0x0C : 0) | \
+    (((m) & 4) ? 0x30 : 0) | (((m) & 8) ? 0xC0 : 0))
+#define SORT_SIMD_BLENDV64(a, b, m) _mm_castpd_si128(_mm_blendv_pd( \
+    _mm_castsi128_pd(a), _mm_castsi128_pd(b), _mm_castsi128_pd(m)))
+#endif
+
+/* Keys of each kind as signed integers: the sign bit flips for unsigned keys,
+   and every other bit flips for negative floating-point ones.  Doing it twice
+   gives back what we started with. */
+SORT_SIMD_INLINE SORT_SIMD_V SORT_SIMD_KEY(const int bits, const SORT_SIMD_V x,
+    const SORT_SIMD_V flip, const SORT_SIMD_V negative) {
+  const SORT_SIMD_V sign = bits == 32 ? SORT_SIMD_SRAI32(x, 31) :
+                           SORT_SIMD_CMPGT64(SORT_SIMD_ZERO(), x);
+  const SORT_SIMD_V rest = bits == 32 ? SORT_SIMD_SRLI32(sign, 1) : SORT_SIMD_SRLI64(sign, 1);
+  return SORT_SIMD_XOR(x, SORT_SIMD_OR(flip, SORT_SIMD_AND(rest, negative)));
+}
+
+/* Without AVX-512 there is no 64-bit min and max, so those pick with the
+   comparison's sign bits. */
+SORT_SIMD_INLINE SORT_SIMD_V SORT_SIMD_MIN(const int bits, const SORT_SIMD_V a,
+    const SORT_SIMD_V b) {
+#if SORT_SIMD_EVEX
+  return bits == 32 ? SORT_SIMD_MIN32(a, b) : _mm256_min_epi64(a, b);
+#else
+  return bits == 32 ? SORT_SIMD_MIN32(a, b) : SORT_SIMD_BLENDV64(a, b, SORT_SIMD_CMPGT64(a, b));
+#endif
+}
+
+SORT_SIMD_INLINE SORT_SIMD_V SORT_SIMD_MAX(const int bits, const SORT_SIMD_V a,
+    const SORT_SIMD_V b) {
+#if SORT_SIMD_EVEX
+  return bits == 32 ? SORT_SIMD_MAX32(a, b) : _mm256_max_epi64(a, b);
+#else
+  return bits == 32 ? SORT_SIMD_MAX32(a, b) : SORT_SIMD_BLENDV64(b, a, SORT_SIMD_CMPGT64(a, b));
+#endif
+}
+
+/* One comparator on every lane: each lane meets the lane that perm moved next to
+   it, and the lanes set in mask (as 32-bit lanes) keep the bigger of the two.
+   Without a 64-bit min and max, a 64-bit lane takes its partner when that is the
+   one it should keep, which is a single pick rather than a min, a max and a blend. */
+#define SORT_SIMD_STEP(bits, v, perm, mask) do { \
+  const SORT_SIMD_V _sort_simd_p = (perm); \
+  if (((bits) == 32) || SORT_SIMD_EVEX) { \
+    (v) = SORT_SIMD_BLEND32(SORT_SIMD_MIN((bits), (v), _sort_simd_p), \
+                            SORT_SIMD_MAX((bits), (v), _sort_simd_p), (mask)); \
+  } else { \
+    (v) = SORT_SIMD_BLENDV64((v), _sort_simd_p, SORT_SIMD_XOR( \
+                               SORT_SIMD_CMPGT64((v), _sort_simd_p), SORT_SIMD_BLEND32( \
+                                 SORT_SIMD_ZERO(), SORT_SIMD_SET1_32(-1), (mask)))); \
+  } \
+} while (0)
+
+SORT_SIMD_INLINE SORT_SIMD_V SORT_SIMD_REVERSE(const int bits, const SORT_SIMD_V v) {
+#if SORT_SIMD_WIDTH == 256
+  return bits == 32 ? _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)) :
+         _mm256_permute4x64_epi64(v, 0x1B);
+#else
+  return bits == 32 ? _mm_shuffle_epi32(v, 0x1B) : _mm_shuffle_epi32(v, 0x4E);
+#endif
+}
+
+/* Sort the lanes of one register: a bitonic network in which every merge starts by
+   folding its block in half, so that nothing ever has to be sorted backwards. */
+SORT_SIMD_INLINE SORT_SIMD_V SORT_SIMD_SORT_LANES(const int bits, SORT_SIMD_V v) {
+  if (bits == 32) {
+    SORT_SIMD_STEP(32, v, SORT_SIMD_SHUFFLE32(v, 0xB1), 0xAA);
+    SORT_SIMD_STEP(32, v, SORT_SIMD_SHUFFLE32(v, 0x1B), 0xCC);
+    SORT_SIMD_STEP(32, v, SORT_SIMD_SHUFFLE32(v, 0xB1), 0xAA);
+#if SORT_SIMD_WIDTH == 256
+    SORT_SIMD_STEP(32, v, SORT_SIMD_REVERSE(32, v), 0xF0);
+    SORT_SIMD_STEP(32, v, SORT_SIMD_SHUFFLE32(v, 0x4E), 0xCC);
+    SORT_SIMD_STEP(32, v, SORT_SIMD_SHUFFLE32(v, 0xB1), 0xAA);
+#endif
+  } else {
+    SORT_SIMD_STEP(64, v, SORT_SIMD_SHUFFLE32(v, 0x4E), 0xCC);
+#if SORT_SIMD_WIDTH == 256
+    SORT_SIMD_STEP(64, v, SORT_SIMD_REVERSE(64, v), 0xF0);
+    SORT_SIMD_STEP(64, v, SORT_SIMD_SHUFFLE32(v, 0x4E), 0xCC);
+#endif
+  }
+
+  return v;
+}
+
+/* The half cleaners of a bitonic merge inside one register. */
+SORT_SIMD_INLINE SORT_SIMD_V SORT_SIMD_CLEAN_LANES(const int bits, SORT_SIMD_V v) {
+#if SORT_SIMD_WIDTH == 256
+  SORT_SIMD_STEP(bits, v, _mm256_permute2x128_si256(v, v, 1), 0xF0);
+#endif
+
+  if (bits == 32) {
+    SORT_SIMD_STEP(32, v, SORT_SIMD_SHUFFLE32(v, 0x4E), 0xCC);
+    SORT_SIMD_STEP(32, v, SORT_SIMD_SHUFFLE32(v, 0xB1), 0xAA);
+  } else {
+    SORT_SIMD_STEP(64, v, SORT_SIMD_SHUFFLE32(v, 0x4E), 0xCC);
+  }
+
+  return v;
+}
+
+/* Merge the sorted keys in the width registers at v with the sorted keys in the
+   width registers after them, so that all 2 * width are in order. */
+SORT_SIMD_INLINE void SORT_SIMD_MERGE_REGS(const int bits, SORT_SIMD_V *v, const int width) {
+  SORT_SIMD_V *hi = v + width;
+  SORT_SIMD_V low;
+  int i, d;
+
+  /* fold: the i-th key from the bottom meets the i-th from the top */
+  for (i = 0; i < width; i++) {
+    const SORT_SIMD_V top = SORT_SIMD_REVERSE(bits, hi[width - 1 - i]);
+    low = SORT_SIMD_MIN(bits, v[i], top);
+    hi[width - 1 - i] = SORT_SIMD_REVERSE(bits, SORT_SIMD_MAX(bits, v[i], top));
+    v[i] = low;
+  }
+
+  for (d = width / 2; d > 0; d /= 2) {
+    for (i = 0; i < 2 * width; i++) {
+      if ((i & d) == 0) {
+        low = SORT_SIMD_MIN(bits, v[i], v[i + d]);
+        v[i + d] = SORT_SIMD_MAX(bits, v[i], v[i + d]);
+        v[i] = low;
+      }
+    }
+  }
+
+  for (i = 0; i < 2 * width; i++) {
+    v[i] = SORT_SIMD_CLEAN_LANES(bits, v[i]);
+  }
+}
+
+/* Sort regs (a power of two, at most 8) registers as one sequence: sort each one,
+   then merge them in pairs, fours and eights. */
+SORT_SIMD_INLINE void SORT_SIMD_SORT_REGS(const int bits, SORT_SIMD_V *v, const int regs) {
+  int width, block, i;
+
+  for (i = 0; i < regs; i++) {
+    v[i] = SORT_SIMD_SORT_LANES(bits, v[i]);
+  }
+
+  for (width = 1; width < regs; width *= 2) {
+    for (block = 0; block < regs; block += 2 * width) {
+      SORT_SIMD_MERGE_REGS(bits, v + block, width);
+    }
+  }
+}
+
+/* The first filled keys at src, as keys, padded out with pad: with a masked load
+   where there is one, and through a buffer where there isn't. */
+SORT_SIMD_INLINE SORT_SIMD_V SORT_SIMD_LOAD(const int bits, const char *src,
+    const size_t filled, const SORT_SIMD_V pad, const SORT_SIMD_V flip,
+    const SORT_SIMD_V negative) {
+#if SORT_SIMD_EVEX
+  const __mmask8 mask = (__mmask8)((1U << filled) - 1U);
+
+  if (bits == 32) {
+    return _mm256_mask_mov_epi32(pad, mask, SORT_SIMD_KEY(32, _mm256_maskz_loadu_epi32(mask, src),
+                                 flip, negative));
+  }
+
+  return _mm256_mask_mov_epi64(pad, mask, SORT_SIMD_KEY(64, _mm256_maskz_loadu_epi64(mask, src),
+                               flip, negative));
+#elif SORT_SIMD_WIDTH == 256
+  __m256i mask, v;
+
+  if (bits == 32) {
+    mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int)filled),
+                              _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    v = _mm256_maskload_epi32((const int *)src, mask);
+  } else {
+    mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)filled),
+                              _mm256_setr_epi64x(0, 1, 2, 3));
+    v = _mm256_maskload_epi64((const long long *)src, mask);
+  }
+
+  return _mm256_blendv_epi8(pad, SORT_SIMD_KEY(bits, v, flip, negative), mask);
+#else
+  __m128i buffer = SORT_SIMD_KEY(bits, pad, flip, negative);
+  memcpy(&buffer, src, filled * (bits / 8));
+  return SORT_SIMD_KEY(bits, buffer, flip, negative);
+#endif
+}
+
+/* Store the first filled keys of v at dst, leaving the rest alone. */
+SORT_SIMD_INLINE void SORT_SIMD_STORE(const int bits, char *dst, const size_t filled,
+                                      const SORT_SIMD_V v) {
+#if SORT_SIMD_EVEX
+  const __mmask8 mask = (__mmask8)((1U << filled) - 1U);
+
+  if (bits == 32) {
+    _mm256_mask_storeu_epi32(dst, mask, v);
+  } else {
+    _mm256_mask_storeu_epi64(dst, mask, v);
+  }
+
+#elif SORT_SIMD_WIDTH == 256
+
+  if (bits == 32) {
+    _mm256_maskstore_epi32((int *)dst, _mm256_cmpgt_epi32(_mm256_set1_epi32((int)filled),
+                           _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), v);
+  } else {
+    _mm256_maskstore_epi64((long long *)dst, _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)filled),
+                           _mm256_setr_epi64x(0, 1, 2, 3)), v);
+  }
+
+#else
+  memcpy(dst, &v, filled * (bits / 8));
+#endif
+}
+
+/* Sort size keys at dst in regs registers, the last of which may be ragged: that
+   one is padded with the biggest key, which sorts last and so is never stored. */
+SORT_SIMD_INLINE void SORT_SIMD_NETWORK_REGS(const int bits, const int kind, char *dst,
+    const size_t size, const int regs) {
+  const size_t lanes = SORT_SIMD_WIDTH / bits;
+  const size_t bytes = SORT_SIMD_WIDTH / 8;
+  const SORT_SIMD_V flip = (kind == SORT_SIMD_U32) ? SORT_SIMD_SET1_32((int)0x80000000U) :
+                           (kind == SORT_SIMD_U64) ?
+                           SORT_SIMD_SET1_64((long long)0x8000000000000000ULL) : SORT_SIMD_ZERO();
+  const SORT_SIMD_V negative = ((kind == SORT_SIMD_F32) || (kind == SORT_SIMD_F64)) ?
+                               SORT_SIMD_SET1_32(-1) : SORT_SIMD_ZERO();
+  const SORT_SIMD_V pad = bits == 32 ? SORT_SIMD_SET1_32(0x7FFFFFFF) :
+                          SORT_SIMD_SET1_64(0x7FFFFFFFFFFFFFFFLL);
+  SORT_SIMD_V v[8];
+  size_t filled;
+  int i;
+
+  for (i = 0; i < regs; i++) {
+    filled = size - MIN(size, i * lanes);
+
+    if (filled >= lanes) {
+      v[i] = SORT_SIMD_KEY(bits, SORT_SIMD_LOADU(dst + bytes * i), flip, negative);
+    } else if (filled > 0) {
+      v[i] = SORT_SIMD_LOAD(bits, dst + bytes * i, filled, pad, flip, negative);
+    } else {
+      v[i] = pad;
+    }
+  }
+
+  SORT_SIMD_SORT_REGS(bits, v, regs);
+
+  for (i = 0; i < regs; i++) {
+    filled = size - MIN(size, i * lanes);
+    v[i] = SORT_SIMD_KEY(bits, v[i], flip, negative);
+
+    if (filled >= lanes) {
+      SORT_SIMD_STOREU(dst + bytes * i, v[i]);
+    } else if (filled > 0) {
+      SORT_SIMD_STORE(bits, dst + bytes * i, filled, v[i]);
+    }
+  }
+}
+
+/* One function per register count, each with its own registers to itself. */
+SORT_SIMD_STATIC void SORT_SIMD_NETWORK_X1(const int kind, char *dst, const size_t size) {
+  if (kind >= SORT_SIMD_I64) {
+    SORT_SIMD_NETWORK_REGS(64, kind, dst, size, 1);
+  } else {
+    SORT_SIMD_NETWORK_REGS(32, kind, dst, size, 1);
+  }
+}
+
+SORT_SIMD_STATIC void SORT_SIMD_NETWORK_X2(const int kind, char *dst, const size_t size) {
+  if (kind >= SORT_SIMD_I64) {
+    SORT_SIMD_NETWORK_REGS(64, kind, dst, size, 2);
+  } else {
+    SORT_SIMD_NETWORK_REGS(32, kind, dst, size, 2);
+  }
+}
+
+SORT_SIMD_STATIC void SORT_SIMD_NETWORK_X4(const int kind, char *dst, const size_t size) {
+  if (kind >= SORT_SIMD_I64) {
+    SORT_SIMD_NETWORK_REGS(64, kind, dst, size, 4);
+  } else {
+    SORT_SIMD_NETWORK_REGS(32, kind, dst, size, 4);
+  }
+}
+
+SORT_SIMD_STATIC void SORT_SIMD_NETWORK_X8(const int kind, char *dst, const size_t size) {
+  if (kind >= SORT_SIMD_I64) {
+    SORT_SIMD_NETWORK_REGS(64, kind, dst, size, 8);
+  } else {
+    SORT_SIMD_NETWORK_REGS(32, kind, dst, size, 8);
+  }
+}
+
+/* Indexed by how many times over one register needs doubling to hold the keys. */
+static void (*const SORT_SIMD_NETWORKS[4])(const int, char *, const size_t) = {
+  SORT_SIMD_NETWORK_X1, SORT_SIMD_NETWORK_X2, SORT_SIMD_NETWORK_X4, SORT_SIMD_NETWORK_X8
+};
+
+static __inline int SORT_SIMD_NETWORK(const int kind, char *dst, const size_t size) {
+  const size_t lanes = SORT_SIMD_WIDTH / (kind >= SORT_SIMD_I64 ? 64 : 32);
+  const size_t regs = (size + lanes - 1) / lanes;
+
+  if (regs > 8) {
+    return 0;
+  }
+
+  SORT_SIMD_NETWORKS[regs > 1 ? 64 - CLZ(regs - 1) : 0](kind, dst, size);
+  return 1;
+}
+
+/* The lanes of v with those set in mask (of 32-bit lanes) in front of the rest. */
+SORT_SIMD_INLINE SORT_SIMD_V SORT_SIMD_COMPRESS(const SORT_SIMD_V v, const int mask) {
+#if SORT_SIMD_WIDTH == 256
+  return _mm256_permutevar8x32_epi32(v, _mm256_srlv_epi32(
+                                       _mm256_set1_epi32((int)sort_simd_compress8[mask]),
+                                       _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21)));
+#else
+  return _mm_shuffle_epi8(v, _mm_loadu_si128((const __m128i *)sort_simd_compress4[mask]));
+#endif
+}
+
+/* v as keys, for the kinds that aren't already. */
+SORT_SIMD_INLINE SORT_SIMD_V SORT_SIMD_KEYS(const int bits, const int kind, const SORT_SIMD_V v) {
+  if ((kind == SORT_SIMD_I32) || (kind == SORT_SIMD_I64)) {
+    return v;
+  }
+
+  return SORT_SIMD_KEY(bits, v, (kind == SORT_SIMD_U32) ? SORT_SIMD_SET1_32((int)0x80000000U) :
+                       (kind == SORT_SIMD_U64) ?
+                       SORT_SIMD_SET1_64((long long)0x8000000000000000ULL) : SORT_SIMD_ZERO(),
+                       ((kind == SORT_SIMD_F32) || (kind == SORT_SIMD_F64)) ?
+                       SORT_SIMD_SET1_32(-1) : SORT_SIMD_ZERO());
+}
+
+/* Which lanes of v are less than the pivot p (a key), as a mask of 32-bit lanes. */
+SORT_SIMD_INLINE int SORT_SIMD_LESS(const int bits, const int kind, const SORT_SIMD_V v,
+                                    const SORT_SIMD_V p) {
+  const SORT_SIMD_V key = SORT_SIMD_KEYS(bits, kind, v);
+  return SORT_SIMD_MOVEMASK32(bits == 32 ? SORT_SIMD_CMPGT32(p, key) : SORT_SIMD_CMPGT64(p, key));
+}
+
+/* Store the first n lanes of v exactly where they go (any others hold the pivot):
+   the ones less than the pivot p at *left, moving it up, and the rest just below
+   *right, moving it down. */
+SORT_SIMD_INLINE void SORT_SIMD_SPLIT(const int bits, const int kind, char *dst,
+                                      const size_t n, const SORT_SIMD_V v, const SORT_SIMD_V p,
+                                      size_t *left, size_t *right) {
+  const int mask = SORT_SIMD_LESS(bits, kind, v, p);
+  const size_t less = (size_t)__builtin_popcount(mask) / (bits / 32);
+  const size_t bytes = bits / 8;
+  SORT_SIMD_V moved;
+  SORT_SIMD_STOREU(&moved, SORT_SIMD_COMPRESS(v, mask));
+  memcpy(dst + bytes * *left, &moved, bytes * less);
+  memcpy(dst + bytes * (*right - (n - less)), (char *)&moved + bytes * less, bytes * (n - less));
+  *left += less;
+  *right -= n - less;
+}
+
+/* Partition the size keys at dst around the one at pivot, and return how many are
+   less than it.  SORT_SIMD_UNROLL vectors are read from each end first, which
+   leaves room for that many on both sides: from then on that many are read at a
+   time from whichever side has less room, and each is stored whole at both, its
+   keys less than the pivot first, so that those are kept at the bottom and the
+   rest at the top.  What's left in the middle and the vectors from the ends then
+   fill the gap exactly. */
+SORT_SIMD_INLINE size_t SORT_SIMD_PARTITION_KIND(const int bits, const int kind, char *dst,
+    const size_t size, const void *pivot) {
+  const size_t lanes = SORT_SIMD_WIDTH / bits;
+  const size_t block = SORT_SIMD_UNROLL * lanes;
+  const size_t bytes = bits / 8;
+  size_t left = 0, right = size, read_left = block, read_right = size - block;
+  SORT_SIMD_V first[SORT_SIMD_UNROLL], last[SORT_SIMD_UNROLL], v[SORT_SIMD_UNROLL];
+  SORT_SIMD_V raw, p;
+  int32_t pivot32;
+  long long pivot64;
+  int mask[SORT_SIMD_UNROLL];
+  int j, from_left;
+  size_t less, at;
+
+  if (bits == 32) {
+    memcpy(&pivot32, pivot, sizeof(pivot32));
+    raw = SORT_SIMD_SET1_32(pivot32);
+  } else {
+    memcpy(&pivot64, pivot, sizeof(pivot64));
+    raw = SORT_SIMD_SET1_64(pivot64);
+  }
+
+  p = SORT_SIMD_KEYS(bits, kind, raw);
+
+  for (j = 0; j < SORT_SIMD_UNROLL; j++) {
+    first[j] = SORT_SIMD_LOADU(dst + bytes * lanes * j);
+    last[j] = SORT_SIMD_LOADU(dst + bytes * (read_right + lanes * j));
+  }
+
+  while (read_right - read_left >= block) {
+    /* which side that is is anyone's guess, so don't branch on it */
+    from_left = read_left - left <= right - read_right;
+    at = from_left ? read_left : read_right - block;
+    read_left += from_left ? block : 0;
+    read_right -= from_left ? 0 : block;
+
+    for (j = 0; j < SORT_SIMD_UNROLL; j++) {
+      v[j] = SORT_SIMD_LOADU(dst + bytes * (at + lanes * j));
+      mask[j] = SORT_SIMD_LESS(bits, kind, v[j], p);
+      v[j] = SORT_SIMD_COMPRESS(v[j], mask[j]);
+    }
+
+    for (j = 0; j < SORT_SIMD_UNROLL; j++) {
+      less = (size_t)__builtin_popcount(mask[j]) / (bits / 32);
+      SORT_SIMD_STOREU(dst + bytes * left, v[j]);
+      SORT_SIMD_STOREU(dst + bytes * (right - lanes), v[j]);
+      left += less;
+      right -= lanes - less;
+    }
+  }
+
+  if (read_right > read_left) {
+    /* the middle, padded out with the pivot */
+    for (j = 0; j < SORT_SIMD_UNROLL; j++) {
+      v[j] = raw;
+    }
+
+    memcpy(v, dst + bytes * read_left, bytes * (read_right - read_left));
+
+    for (j = 0; j < SORT_SIMD_UNROLL; j++) {
+      at = read_left + lanes * j;
+      SORT_SIMD_SPLIT(bits, kind, dst, at < read_right ? MIN(lanes, read_right - at) : 0, v[j], p,
+                      &left, &right);
+    }
+  }
+
+  for (j = 0; j < SORT_SIMD_UNROLL; j++) {
+    SORT_SIMD_SPLIT(bits, kind, dst, lanes, first[j], p, &left, &right);
+    SORT_SIMD_SPLIT(bits, kind, dst, lanes, last[j], p, &left, &right);
+  }
+
+  return left;
+}
+
+/* One function per kind, so that each knows its own. */
+#define SORT_SIMD_PARTITION_DEF(name, bits, kind) \
+SORT_SIMD_STATIC size_t name(char *dst, const size_t size, const void *pivot) { \
+  return SORT_SIMD_PARTITION_KIND(bits, kind, dst, size, pivot); \
+}
+
+SORT_SIMD_PARTITION_DEF(SORT_SIMD_PARTITION_I32, 32, SORT_SIMD_I32)
+SORT_SIMD_PARTITION_DEF(SORT_SIMD_PARTITION_U32, 32, SORT_SIMD_U32)
+SORT_SIMD_PARTITION_DEF(SORT_SIMD_PARTITION_F32, 32, SORT_SIMD_F32)
+SORT_SIMD_PARTITION_DEF(SORT_SIMD_PARTITION_I64, 64, SORT_SIMD_I64)
+SORT_SIMD_PARTITION_DEF(SORT_SIMD_PARTITION_U64, 64, SORT_SIMD_U64)
+SORT_SIMD_PARTITION_DEF(SORT_SIMD_PARTITION_F64, 64, SORT_SIMD_F64)
+
+/* Indexed by kind. */
+static size_t (*const SORT_SIMD_PARTITIONS[7])(char *, const size_t, const void *) = {
+  NULL, SORT_SIMD_PARTITION_I32, SORT_SIMD_PARTITION_U32, SORT_SIMD_PARTITION_F32,
+  SORT_SIMD_PARTITION_I64, SORT_SIMD_PARTITION_U64, SORT_SIMD_PARTITION_F64
+};
+
+static __inline size_t SORT_SIMD_PARTITION(const int kind, char *dst, const size_t size,
+    const void *pivot) {
+  return SORT_SIMD_PARTITIONS[kind](dst, size, pivot);
+}
+
+/* Merge the sorted keys at a (na of them) and b (nb) into dst, 2 * SORT_SIMD_MERGE_UNROLL
+   registers at a time: the smaller half of each merge is stored, and the bigger half
+   is merged next with the block of whichever list has the smaller key up next.  That
+   stops when that list doesn't have a whole block left, and then the keys still in
+   registers are given back to the lists they came from.  Returns how many keys were
+   stored, setting *used_a to how many of them came from a.  Only integer keys come
+   here: equal ones are identical, so which list a tie is taken from doesn't show.
+   dst may be b - na, since the keys are stored no further than b has been read. */
+SORT_SIMD_INLINE size_t SORT_SIMD_MERGE_KIND(const int bits, const int kind, char *dst,
+    const char *a, const size_t na, const char *b, const size_t nb, size_t *used_a) {
+  const size_t lanes = SORT_SIMD_WIDTH / bits;
+  const size_t block = SORT_SIMD_MERGE_UNROLL * lanes;
+  const size_t bytes = bits / 8;
+  SORT_SIMD_V v[2 * SORT_SIMD_MERGE_UNROLL];
+  size_t i = block, j = block, k = 0;
+  const char *next;
+  int r, from_a;
+
+  if ((na < block) || (nb < block)) {
+    return 0;
+  }
+
+  for (r = 0; r < SORT_SIMD_MERGE_UNROLL; r++) {
+    v[r] = SORT_SIMD_KEYS(bits, kind, SORT_SIMD_LOADU(a + bytes * lanes * r));
+    v[SORT_SIMD_MERGE_UNROLL + r] = SORT_SIMD_KEYS(bits, kind,
+                                    SORT_SIMD_LOADU(b + bytes * lanes * r));
+  }
+
+  while (1) {
+    SORT_SIMD_MERGE_REGS(bits, v, SORT_SIMD_MERGE_UNROLL);
+
+    for (r = 0; r < SORT_SIMD_MERGE_UNROLL; r++) {
+      SORT_SIMD_STOREU(dst + bytes * (k + lanes * r), SORT_SIMD_KEYS(bits, kind, v[r]));
+      v[r] = v[SORT_SIMD_MERGE_UNROLL + r];
+    }
+
+    k += block;
+
+    if (i == na) {
+      from_a = 0;
+    } else if (j == nb) {
+      from_a = 1;
+    } else {
+      /* the lists take turns at random, so pick without a branch */
+      from_a = sort_simd_key_at(kind, a + bytes * i) <= sort_simd_key_at(kind, b + bytes * j);
+    }
+
+    if ((from_a ? na - i : nb - j) < block) {
+      break;
+    }
+
+    next = from_a ? a + bytes * i : b + bytes * j;
+    i += from_a ? block : 0;
+    j += from_a ? 0 : block;
+
+    for (r = 0; r < SORT_SIMD_MERGE_UNROLL; r++) {
+      v[SORT_SIMD_MERGE_UNROLL + r] = SORT_SIMD_KEYS(bits, kind,
+                                      SORT_SIMD_LOADU(next + bytes * lanes * r));
+    }
+  }
+
+  /* the biggest block of keys read are the ones left in registers */
+  while (i + j > k) {
+    if ((j == 0) || ((i > 0) && (sort_simd_key_at(kind, a + bytes * (i - 1)) >
+                                 sort_simd_key_at(kind, b + bytes * (j - 1))))) {
+      i--;
+    } else {
+      j--;
+    }
+  }
+
+  *used_a = i;
+  return k;
+}
+
+/* The same from the top down: the biggest keys are stored at the end of dst (which
+   holds na + nb), and the ones read from the ends of a and b.  dst may be a, since
+   the keys are stored no further down than a has been read. */
+SORT_SIMD_INLINE size_t SORT_SIMD_MERGE_BACK_KIND(const int bits, const int kind, char *dst,
+    const char *a, const size_t na, const char *b, const size_t nb, size_t *used_a) {
+  const size_t lanes = SORT_SIMD_WIDTH / bits;
+  const size_t block = SORT_SIMD_MERGE_UNROLL * lanes;
+  const size_t bytes = bits / 8;
+  SORT_SIMD_V v[2 * SORT_SIMD_MERGE_UNROLL];
+  size_t i = na - block, j = nb - block, k = na + nb;
+  const char *next;
+  int r, from_a;
+
+  if ((na < block) || (nb < block)) {
+    return 0;
+  }
+
+  for (r = 0; r < SORT_SIMD_MERGE_UNROLL; r++) {
+    v[r] = SORT_SIMD_KEYS(bits, kind, SORT_SIMD_LOADU(a + bytes * (i + lanes * r)));
+    v[SORT_SIMD_MERGE_UNROLL + r] = SORT_SIMD_KEYS(bits, kind,
+                                    SORT_SIMD_LOADU(b + bytes * (j + lanes * r)));
+  }
+
+  while (1) {
+    SORT_SIMD_MERGE_REGS(bits, v, SORT_SIMD_MERGE_UNROLL);
+    k -= block;
+
+    for (r = 0; r < SORT_SIMD_MERGE_UNROLL; r++) {
+      SORT_SIMD_STOREU(dst + bytes * (k + lanes * r),
+                       SORT_SIMD_KEYS(bits, kind, v[SORT_SIMD_MERGE_UNROLL + r]));
+    }
+
+    if (i == 0) {
+      from_a = 0;
+    } else if (j == 0) {
+      from_a = 1;
+    } else {
+      from_a = sort_simd_key_at(kind, a + bytes * (i - 1)) >
+               sort_simd_key_at(kind, b + bytes * (j - 1));
+    }
+
+    if ((from_a ? i : j) < block) {
+      break;
+    }
+
+    i -= from_a ? block : 0;
+    j -= from_a ? 0 : block;
+    next = from_a ? a + bytes * i : b + bytes * j;
+
+    for (r = 0; r < SORT_SIMD_MERGE_UNROLL; r++) {
+      v[SORT_SIMD_MERGE_UNROLL + r] = SORT_SIMD_KEYS(bits, kind,
+                                      SORT_SIMD_LOADU(next + bytes * lanes * r));
+    }
+  }
+
+  /* the smallest block of keys read are the ones left in registers */
+  while ((na - i) + (nb - j) > na + nb - k) {
+    if ((j == nb) || ((i < na) && (sort_simd_key_at(kind, a + bytes * i) <=
+                                   sort_simd_key_at(kind, b + bytes * j)))) {
+      i++;
+    } else {
+      j++;
+    }
+  }
+
+  *used_a = na - i;
+  return na + nb - k;
+}
+
+/* One pair of functions per size of key, which are told the kind. */
+#define SORT_SIMD_MERGE_DEF(name, kernel, bits) \
+SORT_SIMD_STATIC size_t name(const int kind, char *dst, const char *a, const size_t na, \
+                             const char *b, const size_t nb, size_t *used_a) { \
+  return kernel(bits, kind, dst, a, na, b, nb, used_a); \
+}
+
+SORT_SIMD_MERGE_DEF(SORT_SIMD_MERGE_32, SORT_SIMD_MERGE_KIND, 32)
+SORT_SIMD_MERGE_DEF(SORT_SIMD_MERGE_64, SORT_SIMD_MERGE_KIND, 64)
+SORT_SIMD_MERGE_DEF(SORT_SIMD_MERGE_BACK_32, SORT_SIMD_MERGE_BACK_KIND, 32)
+SORT_SIMD_MERGE_DEF(SORT_SIMD_MERGE_BACK_64, SORT_SIMD_MERGE_BACK_KIND, 64)
+
+static __inline size_t SORT_SIMD_MERGE(const int kind, const int back, char *dst, const char *a,
+                                       const size_t na, const char *b, const size_t nb,
+                                       size_t *used_a) {
+  if (kind >= SORT_SIMD_I64) {
+    return (back ? SORT_SIMD_MERGE_BACK_64 : SORT_SIMD_MERGE_64)(kind, dst, a, na, b, nb, used_a);
+  }
+
+  return (back ? SORT_SIMD_MERGE_BACK_32 : SORT_SIMD_MERGE_32)(kind, dst, a, na, b, nb, used_a);
+}
+
+/* Which lanes of next are less than the lane before them in prev, as a mask of
+   32-bit lanes.  Floating-point keys are compared as they are, so that NaNs are
+   never less than anything, as with the default SORT_CMP. */
+SORT_SIMD_INLINE int SORT_SIMD_DESCENT(const int bits, const int kind, const SORT_SIMD_V prev,
+                                       const SORT_SIMD_V next) {
+  if (kind == SORT_SIMD_F32) {
+    return SORT_SIMD_MOVEMASK32(SORT_SIMD_FCMPGT32(prev, next));
+  }
+
+  if (kind == SORT_SIMD_F64) {
+    return SORT_SIMD_MOVEMASK32(SORT_SIMD_FCMPGT64(prev, next));
+  }
+
+  return SORT_SIMD_MOVEMASK32(bits == 32 ?
+                              SORT_SIMD_CMPGT32(SORT_SIMD_KEYS(32, kind, prev),
+                                  SORT_SIMD_KEYS(32, kind, next)) :
+                              SORT_SIMD_CMPGT64(SORT_SIMD_KEYS(64, kind, prev),
+                                  SORT_SIMD_KEYS(64, kind, next)));
+}
+
+/* The first of the size keys at dst that is less than the one before it, or that
+   isn't if reversed is set, or size if there is no such key; SIZE_MAX if size is
+   too small to take a whole vector.  Each vector is compared with the one a key
+   further down, SORT_SIMD_UNROLL of them at a time, and the last one is moved back
+   to end at size rather than being loaded ragged. */
+SORT_SIMD_INLINE size_t SORT_SIMD_SORTED_UNTIL_KIND(const int bits, const int kind, const char *dst,
+    const size_t size, const int reversed) {
+  const size_t lanes = SORT_SIMD_WIDTH / bits;
+  const size_t bytes = bits / 8;
+  const int flip = reversed ? (1 << (SORT_SIMD_WIDTH / 32)) - 1 : 0;
+  int mask[SORT_SIMD_UNROLL];
+  int j, any;
+  size_t i = 1, at;
+
+  if (size <= lanes) {
+    return SIZE_MAX;
+  }
+
+  while (i + SORT_SIMD_UNROLL * lanes <= size) {
+    any = 0;
+
+    for (j = 0; j < SORT_SIMD_UNROLL; j++) {
+      at = i + lanes * j;
+      mask[j] = SORT_SIMD_DESCENT(bits, kind, SORT_SIMD_LOADU(dst + bytes * (at - 1)),
+                                  SORT_SIMD_LOADU(dst + bytes * at)) ^ flip;
+      any |= mask[j];
+    }
+
+    if (any) {
+      break;
+    }
+
+    i += SORT_SIMD_UNROLL * lanes;
+  }
+
+  while (1) {
+    at = MIN(i, size - lanes);
+    any = SORT_SIMD_DESCENT(bits, kind, SORT_SIMD_LOADU(dst + bytes * (at - 1)),
+                            SORT_SIMD_LOADU(dst + bytes * at)) ^ flip;
+
+    if (any) {
+      return at + (size_t)__builtin_ctz((unsigned)any) / (bits / 32);
+    }
+
+    if (at + lanes == size) {
+      return size;
+    }
+
+    i += lanes;
+  }
+}
+
+/* One function per kind, as for partitioning. */
+#define SORT_SIMD_SORTED_UNTIL_DEF(name, bits, kind) \
+SORT_SIMD_STATIC size_t name(const char *dst, const size_t size, const int reversed) { \
+  return SORT_SIMD_SORTED_UNTIL_KIND(bits, kind, dst, size, reversed); \
+}
+
+SORT_SIMD_SORTED_UNTIL_DEF(SORT_SIMD_SORTED_UNTIL_I32, 32, SORT_SIMD_I32)
+SORT_SIMD_SORTED_UNTIL_DEF(SORT_SIMD_SORTED_UNTIL_U32, 32, SORT_SIMD_U32)
+SORT_SIMD_SORTED_UNTIL_DEF(SORT_SIMD_SORTED_UNTIL_F32, 32, SORT_SIMD_F32)
+SORT_SIMD_SORTED_UNTIL_DEF(SORT_SIMD_SORTED_UNTIL_I64, 64, SORT_SIMD_I64)
+SORT_SIMD_SORTED_UNTIL_DEF(SORT_SIMD_SORTED_UNTIL_U64, 64, SORT_SIMD_U64)
+SORT_SIMD_SORTED_UNTIL_DEF(SORT_SIMD_SORTED_UNTIL_F64, 64, SORT_SIMD_F64)
+
+/* Indexed by kind. */
+static size_t (*const SORT_SIMD_SORTED_UNTILS[7])(const char *, const size_t, const int) = {
+  NULL, SORT_SIMD_SORTED_UNTIL_I32, SORT_SIMD_SORTED_UNTIL_U32, SORT_SIMD_SORTED_UNTIL_F32,
+  SORT_SIMD_SORTED_UNTIL_I64, SORT_SIMD_SORTED_UNTIL_U64, SORT_SIMD_SORTED_UNTIL_F64
+};
+
+static __inline size_t SORT_SIMD_SORTED_UNTIL(const int kind, const char *dst, const size_t size,
+    const int reversed) {
+  return SORT_SIMD_SORTED_UNTILS[kind](dst, size, reversed);
+}
+
+#undef SORT_SIMD_V
+#undef SORT_SIMD_LOADU
+#undef SORT_SIMD_STOREU
+#undef SORT_SIMD_SET1_32
+#undef SORT_SIMD_SET1_64
+#undef SORT_SIMD_ZERO
+#undef SORT_SIMD_XOR
+#undef SORT_SIMD_OR
+#undef SORT_SIMD_AND
+#undef SORT_SIMD_SRAI32
+#undef SORT_SIMD_SRLI32
+#undef SORT_SIMD_SRLI64
+#undef SORT_SIMD_CMPGT32
+#undef SORT_SIMD_CMPGT64
+#undef SORT_SIMD_MOVEMASK32
+#undef SORT_SIMD_MIN32
+#undef SORT_SIMD_MAX32
+#undef SORT_SIMD_SHUFFLE32
+#undef SORT_SIMD_BLEND32
+#undef SORT_SIMD_FCMPGT32
+#undef SORT_SIMD_FCMPGT64
+#undef SORT_SIMD_BLENDV64
+#undef SORT_SIMD_STEP
+#undef SORT_SIMD_KEY
+#undef SORT_SIMD_MIN
+#undef SORT_SIMD_MAX
+#undef SORT_SIMD_REVERSE
+#undef SORT_SIMD_SORT_LANES
+#undef SORT_SIMD_CLEAN_LANES
+#undef SORT_SIMD_MERGE_REGS
+#undef SORT_SIMD_SORT_REGS
+#undef SORT_SIMD_LOAD
+#undef SORT_SIMD_STORE
+#undef SORT_SIMD_NETWORK_REGS
+#undef SORT_SIMD_NETWORK_X1
+#undef SORT_SIMD_NETWORK_X2
+#undef SORT_SIMD_NETWORK_X4
+#undef SORT_SIMD_NETWORK_X8
+#undef SORT_SIMD_NETWORKS
+#undef SORT_SIMD_NETWORK
+#undef SORT_SIMD_COMPRESS
+#undef SORT_SIMD_KEYS
+#undef SORT_SIMD_LESS
+#undef SORT_SIMD_SPLIT
+#undef SORT_SIMD_PARTITION_KIND
+#undef SORT_SIMD_PARTITION_DEF
+#undef SORT_SIMD_PARTITION_I32
+#undef SORT_SIMD_PARTITION_U32
+#undef SORT_SIMD_PARTITION_F32
+#undef SORT_SIMD_PARTITION_I64
+#undef SORT_SIMD_PARTITION_U64
+#undef SORT_SIMD_PARTITION_F64
+#undef SORT_SIMD_PARTITIONS
+#undef SORT_SIMD_PARTITION
+#undef SORT_SIMD_MERGE_KIND
+#undef SORT_SIMD_MERGE_BACK_KIND
+#undef SORT_SIMD_MERGE_DEF
+#undef SORT_SIMD_MERGE_32
+#undef SORT_SIMD_MERGE_64
+#undef SORT_SIMD_MERGE_BACK_32
+#undef SORT_SIMD_MERGE_BACK_64
+#undef SORT_SIMD_MERGE
+#undef SORT_SIMD_DESCENT
+#undef SORT_SIMD_SORTED_UNTIL_KIND
+#undef SORT_SIMD_SORTED_UNTIL_DEF
+#undef SORT_SIMD_SORTED_UNTIL_I32
+#undef SORT_SIMD_SORTED_UNTIL_U32
+#undef SORT_SIMD_SORTED_UNTIL_F32
+#undef SORT_SIMD_SORTED_UNTIL_I64
+#undef SORT_SIMD_SORTED_UNTIL_U64
+#undef SORT_SIMD_SORTED_UNTIL_F64
+#undef SORT_SIMD_SORTED_UNTILS
+#undef SORT_SIMD_SORTED_UNTIL
+#undef SORT_SIMD_INLINE
+#undef SORT_SIMD_STATIC
+#undef SORT_SIMD_CONCAT
+#undef SORT_SIMD_MAKE_STR1
+#undef SORT_SIMD_MAKE_STR
+#undef SORT_SIMD_ISA
+#undef SORT_SIMD_TARGET
+#undef SORT_SIMD_WIDTH
+#undef SORT_SIMD_EVEX
+
+#endif /* SORT_SIMD_ISA */
@@ -3,12 +3,18 @@
 
 #define _XOPEN_SOURCE
 
+/* split much smaller ranges than usual so the test sizes reach the parallel code */
+#define SORT_PARALLEL_CUTOFF 1000
+
 #define SORT_NAME sorter
 #define SORT_TYPE int64_t
 #define SORT_CMP(x, y) ((x) - (y))
 #ifdef SET_SORT_EXTRA
 #define SORT_EXTRA
 #endif
+#ifdef SET_SORT_PARALLEL
+#define SORT_PARALLEL
+#endif
 #include "sort.h"
 
 #define SORT_NAME stable
@@ -17,12 +23,135 @@
 #ifdef SET_SORT_EXTRA
 #define SORT_EXTRA
 #endif
+#ifdef SET_SORT_PARALLEL
+#define SORT_PARALLEL
+#endif
+#include "sort.h"
+
+#define SORT_NAME strings
+#define SORT_TYPE char*
+#define SORT_STRING
+#define SORT_CMP(x, y) strcmp((x), (y))
+#ifdef SET_SORT_PARALLEL
+#define SORT_PARALLEL
+#endif
+#include "sort.h"
+
+/* quick sort partitioning a block at a time, without the vector partition */
+#define SORT_NAME blocks
+#define SORT_TYPE int64_t
+#define SORT_BLOCK_PARTITION
+#define SORT_CMP(x, y) ((x) - (y))
+#include "sort.h"
+
+/* pattern-defeating quick sort */
+#define SORT_NAME pdq
+#define SORT_TYPE int64_t
+#define SORT_PDQSORT
+#define SORT_CMP(x, y) ((x) - (y))
+#include "sort.h"
+
+/* quick sort with a three-way partition, for keys with many duplicates */
+#define SORT_NAME fat
+#define SORT_TYPE int64_t
+#define SORT_FAT_PARTITION
+#define SORT_CMP(x, y) ((x) - (y))
+#include "sort.h"
+
+/* quick sort and in-place merge sort leaving up to 64 elements to a sorting network */
+#define SORT_NAME networks
+#define SORT_TYPE int64_t
+#define SMALL_SORT_BND 64
+#define SORT_CMP(x, y) ((x) - (y))
+#include "sort.h"
+
+/* the kinds of primitive keys the SIMD kernels and radix sort take; prim_i64 also runs
+   the large tests, next to the scalar sorter */
+#define SORT_NAME prim_i64
+#define SORT_TYPE int64_t
+#define SORT_PRIMITIVE
+#ifdef SET_SORT_PARALLEL
+#define SORT_PARALLEL
+#endif
+#include "sort.h"
+
+#define SORT_NAME prim_i32
+#define SORT_TYPE int32_t
+#define SORT_PRIMITIVE
+#include "sort.h"
+
+#define SORT_NAME prim_u32
+#define SORT_TYPE uint32_t
+#define SORT_PRIMITIVE
+#include "sort.h"
+
+#define SORT_NAME prim_u64
+#define SORT_TYPE uint64_t
+#define SORT_PRIMITIVE
+#include "sort.h"
+
+#define SORT_NAME prim_f32
+#define SORT_TYPE float
+#define SORT_PRIMITIVE
+#define SORT_NAN_FIRST
+#include "sort.h"
+
+#define SORT_NAME prim_f64
+#define SORT_TYPE double
+#define SORT_PRIMITIVE
 #include "sort.h"
 
 /* Used to control the stress test */
 #define SEED 123
 #define MAXSIZE 45000
 #define TESTS 1000
+#define TEST_THREADS 4
+
+#ifdef SET_SORT_PARALLEL
+/* a pool kept for the whole run, one that borrows its threads from test_executor,
+   and one that pretends its threads are on two NUMA nodes */
+static sort_ctx *test_ctx;
+static sort_ctx *executor_ctx;
+static sort_ctx *numa_ctx;
+
+/* Stands in for a host program's executor: every job gets a thread of its own. */
+typedef struct {
+  void (*job)(void *arg);
+  void *arg;
+  pthread_t thread;
+} test_job;
+
+typedef struct {
+  test_job jobs[TEST_THREADS];
+  int count;
+} test_executor;
+
+static void *test_job_main(void *arg) {
+  test_job *j = (test_job *) arg;
+  j->job(j->arg);
+  return NULL;
+}
+
+static void test_executor_submit(void *executor, void (*job)(void *arg), void *arg) {
+  test_executor *e = (test_executor *) executor;
+  test_job *j = &e->jobs[e->count++];
+  j->job = job;
+  j->arg = arg;
+
+  if (pthread_create(&j->thread, NULL, test_job_main, j) != 0) {
+    printf("Could not start an executor thread\n");
+    exit(1);
+  }
+}
+
+static void test_executor_wait(void *executor) {
+  test_executor *e = (test_executor *) executor;
+
+  while (e->count > 0) {
+    pthread_join(e->jobs[--e->count].thread, NULL);
+  }
+}
+#endif
 
 #define RAND_RANGE(__n, __min, __max) \
     (__n) = (__min) + (long) ((double) ( (double) (__max) - (__min) + 1.0) * ((__n) / (0x7fffffff + 1.0)))
@@ -37,6 +166,8 @@ enum {
   FILL_SWAPPED_N2,
   FILL_SWAPPED_N8,
   FILL_EVIL,
+  FILL_REVERSED,
+  FILL_FEW_UNIQUE,
   FILL_LAST_ELEMENT
 };
 
@@ -49,7 +180,9 @@ char *test_names[FILL_LAST_ELEMENT] = {
   "sorted blocks of length 10000",
   "swapped size/2 pairs",
   "swapped size/8 pairs",
-  "known evil data"
+  "known evil data",
+  "reversed numbers",
+  "few unique numbers"
 };
 
 /* used for stdlib */
@@ -101,6 +234,22 @@ int verify(int64_t *dst, const int size) {
   return 1;
 }
 
+/* out should hold the k largest of dst, in order */
+int verify_top_k(int64_t *dst, const int size, int64_t *out, const int k) {
+  int i;
+  const int found = k < size ? k : size;
+  sorter_quick_sort(dst, size);
+
+  for (i = 0; i < found; i++) {
+    if (out[i] != dst[size - found + i]) {
+      printf("Verify top k failed! at %d", i);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
 static void fill_random(int64_t *dst, const int size) {
   int i;
 
@@ -125,6 +274,14 @@ static void fill_sorted(int64_t *dst, const int size) {
   }
 }
 
+static void fill_reversed(int64_t *dst, const int size) {
+  int i;
+
+  for (i = 0; i < size; i++) {
+    dst[i] = size - i;
+  }
+}
+
 static void fill_sorted_blocks(int64_t *dst, const int size, const int block_size) {
   int i, filled, this_block_size;
   filled = 0;
@@ -162,6 +319,14 @@ static void fill_evil(int64_t *dst, const int size) {
   }
 }
 
+static void fill_few_unique(int64_t *dst, const int size) {
+  int i;
+
+  for (i = 0; i < size; i++) {
+    dst[i] = lrand48() % 8;
+  }
+}
+
 static void fill(int64_t *dst, const int size, int type) {
   switch (type) {
   case FILL_SORTED:
@@ -196,6 +361,14 @@ static void fill(int64_t *dst, const int size, int type) {
     fill_evil(dst, size);
     break;
 
+  case FILL_REVERSED:
+    fill_reversed(dst, size);
+    break;
+
+  case FILL_FEW_UNIQUE:
+    fill_few_unique(dst, size);
+    break;
+
   case FILL_RANDOM:
   default:
     fill_random(dst, size);
@@ -224,7 +397,7 @@ static void fill(int64_t *dst, const int size, int type) {
 } while (0)
 
 
-#define TEST_SORT_H(name) do { \
+#define TEST_SORT_CALL(name, call) do { \
   res = 0; \
   diff = 0; \
   printf("%-29s", "sort.h " #name); \
@@ -232,7 +405,7 @@ static void fill(int64_t *dst, const int size, int type) {
     int64_t size = sizes[test]; \
     fill(dst, size, type); \
     usec1 = utime(); \
-    sorter_ ## name (dst, size); \
+    call; \
     usec2 = utime(); \
     res = verify(dst, size); \
     if (!res) { \
@@ -244,10 +417,214 @@ static void fill(int64_t *dst, const int size, int type) {
   if (!res) return 0; \
 } while (0)
 
+#define TEST_SORT_H(name) TEST_SORT_CALL(name, sorter_ ## name (dst, size))
+#define TEST_SORT_H_THREADS(name) TEST_SORT_CALL(name, sorter_ ## name (dst, size, test_ctx))
+#define TEST_SORT_H_EXECUTOR(name) TEST_SORT_CALL(name ## _executor, sorter_ ## name (dst, size, executor_ctx))
+#define TEST_SORT_H_NUMA(name) TEST_SORT_CALL(name ## _numa, sorter_ ## name (dst, size, numa_ctx))
+
+/* k runs from 1 to a bit more than the smaller sizes */
+#define TEST_TOP_K_CALL(name, call) do { \
+  res = 0; \
+  diff = 0; \
+  printf("%-29s", "sort.h " #name); \
+  for (test = 0; test < sizes_cnt; test++) { \
+    int64_t size = sizes[test]; \
+    int64_t k = 1 + (size * 7) % 2500; \
+    fill(dst, size, type); \
+    usec1 = utime(); \
+    call; \
+    usec2 = utime(); \
+    res = verify_top_k(dst, size, out, k); \
+    if (!res) { \
+      break; \
+    } \
+    diff += usec2 - usec1; \
+  } \
+  printf(" - %s, %10.1f usec\n", res ? "ok" : "FAILED", diff); \
+  if (!res) return 0; \
+} while (0)
+
+#define TEST_TOP_K(name) TEST_TOP_K_CALL(name, sorter_ ## name (dst, size, k, out))
+#define TEST_TOP_K_THREADS(name) TEST_TOP_K_CALL(name, sorter_ ## name (dst, size, k, out, test_ctx))
+
+/* k-way merges are tested by cutting the array into uneven shards (the first ones
+   often empty), sorting those, and merging them back */
+#define KWAY_SHARDS 37
+#define KWAY_SHARD_START(i, size) ((i) * (i) * (size) / (KWAY_SHARDS * KWAY_SHARDS))
+
+static void kway_merge_sort(int64_t *dst, const size_t size, const int parallel) {
+  int64_t *inputs[KWAY_SHARDS];
+  size_t lens[KWAY_SHARDS];
+  int64_t *out = (int64_t *) malloc(size * sizeof(int64_t));
+  size_t i;
+
+  for (i = 0; i < KWAY_SHARDS; i++) {
+    inputs[i] = dst + KWAY_SHARD_START(i, size);
+    lens[i] = KWAY_SHARD_START(i + 1, size) - KWAY_SHARD_START(i, size);
+    sorter_quick_sort(inputs[i], lens[i]);
+  }
+
+#ifdef SET_SORT_PARALLEL
+
+  if (parallel) {
+    sorter_parallel_kway_merge(inputs, lens, KWAY_SHARDS, out, test_ctx);
+  } else {
+    sorter_kway_merge(inputs, lens, KWAY_SHARDS, out);
+  }
+
+#else
+  (void) parallel;
+  sorter_kway_merge(inputs, lens, KWAY_SHARDS, out);
+#endif
+  memcpy(dst, out, size * sizeof(int64_t));
+  free(out);
+}
+
+/* sort_unique and sort_groups are checked against a sorted copy, which is then
+   handed back for verify; a wrong answer leaves it unsorted so verify fails */
+static void sort_unique_test(int64_t *dst, const size_t size, const int groups,
+                             const int parallel) {
+  int64_t *copy = (int64_t *) malloc(size * sizeof(int64_t));
+  size_t *starts = (size_t *) malloc(size * sizeof(size_t));
+  size_t found, i;
+  size_t n = 0;
+  int ok = 1;
+  memcpy(copy, dst, size * sizeof(int64_t));
+  sorter_quick_sort(copy, size);
+#ifdef SET_SORT_PARALLEL
+
+  if (parallel) {
+    found = groups ? sorter_parallel_sort_groups(dst, size, starts, test_ctx) :
+            sorter_parallel_sort_unique(dst, size, test_ctx);
+  } else {
+    found = groups ? sorter_sort_groups(dst, size, starts) : sorter_sort_unique(dst, size);
+  }
+
+#else
+  (void) parallel;
+  found = groups ? sorter_sort_groups(dst, size, starts) : sorter_sort_unique(dst, size);
+#endif
+
+  for (i = 0; i < size; i++) {
+    if ((i == 0) || (copy[i] != copy[i - 1])) {
+      ok = ok && (n < found) && (groups ? (starts[n] == i) : (dst[n] == copy[i]));
+      n++;
+    }
+  }
+
+  memcpy(dst, copy, size * sizeof(int64_t));
+
+  if ((!ok || (n != found)) && (size > 1)) {
+    dst[0] = dst[size - 1] + 1;
+  }
+
+  free(starts);
+  free(copy);
+}
+
+/* nth_element is checked at a few positions against a sorted copy, which is then
+   handed back for verify the same way */
+static void nth_element_test(int64_t *dst, const size_t size, const int parallel) {
+  int64_t *copy = (int64_t *) malloc(size * sizeof(int64_t));
+  size_t nths[4];
+  size_t t, i;
+  int ok = 1;
+  memcpy(copy, dst, size * sizeof(int64_t));
+  sorter_quick_sort(copy, size);
+  nths[0] = size / 2;
+  nths[1] = size / 7;
+  nths[2] = size - size / 5;
+  nths[3] = size ? size - 1 : 0;
+
+  for (t = 0; t < 4; t++) {
+    const size_t nth = nths[t];
+#ifdef SET_SORT_PARALLEL
+
+    if (parallel) {
+      sorter_parallel_nth_element(dst, size, nth, test_ctx);
+    } else {
+      sorter_nth_element(dst, size, nth);
+    }
+
+#else
+    (void) parallel;
+    sorter_nth_element(dst, size, nth);
+#endif
+
+    if (nth >= size) {
+      continue;
+    }
+
+    ok = ok && (dst[nth] == copy[nth]);
+
+    for (i = 0; i < size; i++) {
+      ok = ok && (i < nth ? dst[i] <= dst[nth] : dst[i] >= dst[nth]);
+    }
+  }
+
+  memcpy(dst, copy, size * sizeof(int64_t));
+
+  if (!ok && (size > 1)) {
+    dst[0] = dst[size - 1] + 1;
+  }
+
+  free(copy);
+}
+
+/* segmented sorts are tested on mostly tiny segments (every 23rd empty), with a
+   bigger one now and then, which are k-way merged back together afterwards */
+static size_t *segment_offsets(const size_t size, size_t *nsegments) {
+  size_t *offsets = (size_t *) malloc((size + size / 8 + 32) * sizeof(size_t));
+  size_t n = 0;
+  offsets[0] = 0;
+
+  while (offsets[n] < size) {
+    const size_t len = (n % 97 == 96) ? 100 + n % 600 : (n * 7919) % 23;
+    offsets[n + 1] = offsets[n] + len < size ? offsets[n] + len : size;
+    n++;
+  }
+
+  *nsegments = n;
+  return offsets;
+}
+
+static void segmented_sort(int64_t *dst, const size_t size, const int parallel) {
+  size_t nsegments, i;
+  size_t *offsets = segment_offsets(size, &nsegments);
+  int64_t **inputs = (int64_t **) malloc((nsegments + 1) * sizeof(int64_t *));
+  size_t *lens = (size_t *) malloc((nsegments + 1) * sizeof(size_t));
+  int64_t *out = (int64_t *) malloc(size * sizeof(int64_t));
+#ifdef SET_SORT_PARALLEL
+
+  if (parallel) {
+    sorter_parallel_segmented_sort(dst, offsets, nsegments, test_ctx);
+  } else {
+    sorter_segmented_sort(dst, offsets, nsegments);
+  }
+
+#else
+  (void) parallel;
+  sorter_segmented_sort(dst, offsets, nsegments);
+#endif
+
+  for (i = 0; i < nsegments; i++) {
+    inputs[i] = dst + offsets[i];
+    lens[i] = offsets[i + 1] - offsets[i];
+  }
+
+  sorter_kway_merge(inputs, lens, nsegments, out);
+  memcpy(dst, out, size * sizeof(int64_t));
+  free(out);
+  free(lens);
+  free(inputs);
+  free(offsets);
+}
+
 int run_tests(int64_t *sizes, int sizes_cnt, int type) {
   int test, res;
   double usec1, usec2, diff;
   int64_t * dst = (int64_t *)malloc(MAXSIZE * sizeof(int64_t));
+  int64_t * out = (int64_t *)malloc(MAXSIZE * sizeof(int64_t));
   printf("-------\nRunning tests with %s:\n-------\n", test_names[type]);
   TEST_STDLIB(qsort);
 #if !defined(__linux__) && !defined(__CYGWIN__) && !defined(_WIN32)
@@ -265,17 +642,54 @@ int run_tests(int64_t *sizes, int sizes_cnt, int type) {
   }
 
   TEST_SORT_H(quick_sort);
+  TEST_SORT_CALL(block_quick_sort, blocks_quick_sort(dst, size));
+  TEST_SORT_CALL(pdq_quick_sort, pdq_quick_sort(dst, size));
+  TEST_SORT_CALL(fat_quick_sort, fat_quick_sort(dst, size));
+  TEST_SORT_CALL(network_quick_sort, networks_quick_sort(dst, size));
+  TEST_SORT_CALL(network_merge_in_place, networks_merge_sort_in_place(dst, size));
   TEST_SORT_H(merge_sort);
   TEST_SORT_H(heap_sort);
   TEST_SORT_H(shell_sort);
   TEST_SORT_H(tim_sort);
   TEST_SORT_H(merge_sort_in_place);
+  TEST_SORT_H(sample_sort);
+  TEST_SORT_CALL(simd_quick_sort, prim_i64_quick_sort(dst, size));
+  TEST_SORT_CALL(simd_merge_sort, prim_i64_merge_sort(dst, size));
+  TEST_SORT_CALL(simd_tim_sort, prim_i64_tim_sort(dst, size));
+  TEST_SORT_CALL(radix_sort, prim_i64_radix_sort(dst, size));
+  TEST_TOP_K(top_k);
+  TEST_SORT_CALL(kway_merge, kway_merge_sort(dst, size, 0));
+  TEST_SORT_CALL(segmented_sort, segmented_sort(dst, size, 0));
+  TEST_SORT_CALL(sort_unique, sort_unique_test(dst, size, 0, 0));
+  TEST_SORT_CALL(sort_groups, sort_unique_test(dst, size, 1, 0));
+  TEST_SORT_CALL(nth_element, nth_element_test(dst, size, 0));
 #ifdef SET_SORT_EXTRA
   TEST_SORT_H(grail_sort);
   TEST_SORT_H(sqrt_sort);
   TEST_SORT_H(rec_stable_sort);
   TEST_SORT_H(grail_sort_dyn_buffer);
 #endif
+#ifdef SET_SORT_PARALLEL
+  TEST_SORT_H_THREADS(parallel_quick_sort);
+  TEST_SORT_H_THREADS(parallel_tim_sort);
+  TEST_SORT_H_THREADS(parallel_merge_sort);
+  TEST_SORT_H_EXECUTOR(parallel_quick_sort);
+  TEST_SORT_H_EXECUTOR(parallel_merge_sort);
+  TEST_SORT_H_NUMA(parallel_merge_sort);
+  TEST_SORT_H_THREADS(parallel_sample_sort);
+  TEST_SORT_H_THREADS(parallel_shell_sort);
+  TEST_SORT_CALL(parallel_radix_sort, prim_i64_parallel_radix_sort(dst, size, test_ctx));
+#ifdef SET_SORT_EXTRA
+  TEST_SORT_H_THREADS(parallel_grail_sort);
+#endif
+  TEST_TOP_K_THREADS(parallel_top_k);
+  TEST_SORT_CALL(parallel_kway_merge, kway_merge_sort(dst, size, 1));
+  TEST_SORT_CALL(parallel_segmented_sort, segmented_sort(dst, size, 1));
+  TEST_SORT_CALL(parallel_sort_unique, sort_unique_test(dst, size, 0, 1));
+  TEST_SORT_CALL(parallel_sort_groups, sort_unique_test(dst, size, 1, 1));
+  TEST_SORT_CALL(parallel_nth_element, nth_element_test(dst, size, 1));
+#endif
+  free(out);
   free(dst);
   return 0;
 }
@@ -365,6 +779,116 @@ void check_stable(char *name, void (*sort_fun)(int **arr, size_t size), int size
   free(array);
 }
 
+/* the same as kway_merge_sort, but with stable shards */
+static void stable_kway_merge_sort(int **arr, const size_t size, const int parallel) {
+  int **inputs[KWAY_SHARDS];
+  size_t lens[KWAY_SHARDS];
+  int **out = (int **) malloc(size * sizeof(int *));
+  size_t i;
+
+  for (i = 0; i < KWAY_SHARDS; i++) {
+    inputs[i] = arr + KWAY_SHARD_START(i, size);
+    lens[i] = KWAY_SHARD_START(i + 1, size) - KWAY_SHARD_START(i, size);
+    stable_tim_sort(inputs[i], lens[i]);
+  }
+
+#ifdef SET_SORT_PARALLEL
+
+  if (parallel) {
+    stable_parallel_kway_merge(inputs, lens, KWAY_SHARDS, out, test_ctx);
+  } else {
+    stable_kway_merge(inputs, lens, KWAY_SHARDS, out);
+  }
+
+#else
+  (void) parallel;
+  stable_kway_merge(inputs, lens, KWAY_SHARDS, out);
+#endif
+  memcpy(arr, out, size * sizeof(int *));
+  free(out);
+}
+
+/* the same as segmented_sort, but stable */
+static void stable_segmented_sort_merge(int **arr, const size_t size, const int parallel) {
+  size_t nsegments, i;
+  size_t *offsets = segment_offsets(size, &nsegments);
+  int ***inputs = (int ***) malloc((nsegments + 1) * sizeof(int **));
+  size_t *lens = (size_t *) malloc((nsegments + 1) * sizeof(size_t));
+  int **out = (int **) malloc(size * sizeof(int *));
+#ifdef SET_SORT_PARALLEL
+
+  if (parallel) {
+    stable_parallel_stable_segmented_sort(arr, offsets, nsegments, test_ctx);
+  } else {
+    stable_stable_segmented_sort(arr, offsets, nsegments);
+  }
+
+#else
+  (void) parallel;
+  stable_stable_segmented_sort(arr, offsets, nsegments);
+#endif
+
+  for (i = 0; i < nsegments; i++) {
+    inputs[i] = arr + offsets[i];
+    lens[i] = offsets[i + 1] - offsets[i];
+  }
+
+  stable_kway_merge(inputs, lens, nsegments, out);
+  memcpy(arr, out, size * sizeof(int *));
+  free(out);
+  free(lens);
+  free(inputs);
+  free(offsets);
+}
+
+static void stable_segmented_sort_segments(int **arr, size_t size) {
+  stable_segmented_sort_merge(arr, size, 0);
+}
+
+static void stable_sort_groups_starts(int **arr, size_t size) {
+  size_t *starts = (size_t *) malloc(size * sizeof(size_t));
+  stable_sort_groups(arr, size, starts);
+  free(starts);
+}
+
+static void stable_kway_merge_shards(int **arr, size_t size) {
+  stable_kway_merge_sort(arr, size, 0);
+}
+
+#ifdef SET_SORT_PARALLEL
+static void stable_parallel_kway_merge_shards(int **arr, size_t size) {
+  stable_kway_merge_sort(arr, size, 1);
+}
+
+static void stable_parallel_segmented_sort_segments(int **arr, size_t size) {
+  stable_segmented_sort_merge(arr, size, 1);
+}
+
+static void stable_parallel_sort_groups_starts(int **arr, size_t size) {
+  size_t *starts = (size_t *) malloc(size * sizeof(size_t));
+  stable_parallel_sort_groups(arr, size, starts, test_ctx);
+  free(starts);
+}
+
+static void stable_parallel_tim_sort_threads(int **arr, size_t size) {
+  stable_parallel_tim_sort(arr, size, test_ctx);
+}
+
+static void stable_parallel_merge_sort_threads(int **arr, size_t size) {
+  stable_parallel_merge_sort(arr, size, test_ctx);
+}
+
+static void stable_parallel_merge_sort_nodes(int **arr, size_t size) {
+  stable_parallel_merge_sort(arr, size, numa_ctx);
+}
+
+#ifdef SET_SORT_EXTRA
+static void stable_parallel_grail_sort_threads(int **arr, size_t size) {
+  stable_parallel_grail_sort(arr, size, test_ctx);
+}
+#endif
+#endif
+
 /* Check which sorts are stable. */
 void stable_tests(void) {
   int size = 100000;
@@ -380,19 +904,298 @@ void stable_tests(void) {
   check_stable("shell sort", stable_shell_sort, size, num_values);
   check_stable("tim sort", stable_tim_sort, size, num_values);
   check_stable("merge (in-place) sort", stable_merge_sort_in_place, size, num_values);
+  check_stable("k-way merge", stable_kway_merge_shards, size, num_values);
+  check_stable("segmented sort", stable_segmented_sort_segments, size, num_values);
+  check_stable("sort groups", stable_sort_groups_starts, size, num_values);
 #ifdef SET_SORT_EXTRA
   check_stable("grail sort", stable_grail_sort, size, num_values);
   check_stable("sqrt sort", stable_sqrt_sort, size, num_values);
   check_stable("rec stable sort", stable_rec_stable_sort, size, num_values);
   check_stable("grail sort dyn byffer", stable_grail_sort_dyn_buffer, size, num_values);
 #endif
+#ifdef SET_SORT_PARALLEL
+  check_stable("parallel tim sort", stable_parallel_tim_sort_threads, size, num_values);
+  check_stable("parallel merge sort", stable_parallel_merge_sort_threads, size, num_values);
+  check_stable("merge sort (numa)", stable_parallel_merge_sort_nodes, size, num_values);
+#ifdef SET_SORT_EXTRA
+  check_stable("parallel grail sort", stable_parallel_grail_sort_threads, size, num_values);
+#endif
+  check_stable("parallel k-way merge", stable_parallel_kway_merge_shards, size, num_values);
+  check_stable("parallel segmented sort", stable_parallel_segmented_sort_segments, size,
+               num_values);
+  check_stable("parallel sort groups", stable_parallel_sort_groups_starts, size, num_values);
+#endif
+}
+
+/* string sorts: keys that share long prefixes, duplicates and empty strings, with
+   the order checked against qsort and every lcp against the strings themselves */
+#define STRING_TESTS 4
+#define STRING_LEN 40
+
+static int string_cmp(const void *a, const void *b) {
+  return strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+static int check_strings(char **keys, char **sorted, size_t *lcp, const size_t size) {
+  size_t i, j;
+
+  for (i = 0; i < size; i++) {
+    if (strcmp(keys[i], sorted[i]) != 0) {
+      return 0;
+    }
+
+    j = 0;
+
+    while ((i > 0) && (keys[i][j] != 0) && (keys[i][j] == keys[i - 1][j])) {
+      j++;
+    }
+
+    if (lcp[i] != j) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int string_tests(void) {
+  const size_t sizes[STRING_TESTS] = {0, 7, 999, 50000};
+  int test, parallel, res = 1;
+
+  for (parallel = 0; parallel < 2; parallel++) {
+    for (test = 0; test < STRING_TESTS; test++) {
+      const size_t size = sizes[test];
+      char *chars = (char *) malloc(size * STRING_LEN + 1);
+      char **keys = (char **) malloc((size + 1) * sizeof(char *));
+      char **sorted = (char **) malloc((size + 1) * sizeof(char *));
+      size_t *lcp = (size_t *) malloc((size + 1) * sizeof(size_t));
+      size_t i, j, len;
+
+      for (i = 0; i < size; i++) {
+        keys[i] = chars + i * STRING_LEN;
+        strcpy(keys[i], (i % 3 == 0) ? "" : "https://example.com/");
+        len = strlen(keys[i]) + lrand48() % 19;
+
+        for (j = strlen(keys[i]); j < len; j++) {
+          keys[i][j] = (char)((i % 5 == 0) ? 'a' + lrand48() % 3 : 1 + lrand48() % 255);
+        }
+
+        keys[i][len] = 0;
+        sorted[i] = keys[i];
+      }
+
+      qsort(sorted, size, sizeof(char *), string_cmp);
+#ifdef SET_SORT_PARALLEL
+
+      if (parallel) {
+        strings_parallel_string_sort_lcp(keys, size, lcp, test_ctx);
+      } else {
+        strings_string_sort_lcp(keys, size, lcp);
+      }
+
+#else
+      strings_string_sort_lcp(keys, size, lcp);
+#endif
+      res = res && check_strings(keys, sorted, lcp, size);
+      free(lcp);
+      free(sorted);
+      free(keys);
+      free(chars);
+    }
+  }
+
+  printf("%21s -- %s\n", "string sort", res ? "ok" : "FAILED");
+  return res;
+}
+
+/* primitive keys of every kind, at every size a sorting network takes and the
+   smallest a vector partition and merge do, with negative numbers, zeros of both signs and
+   lots of duplicates, checked against binary insertion sort */
+#define PRIMITIVE_ROUNDS 20
+#define PRIMITIVE_MAX 200
+
+#define PRIMITIVE_TEST(name, type, value) do { \
+  type keys[PRIMITIVE_MAX], quick[PRIMITIVE_MAX], merge[PRIMITIVE_MAX], tim[PRIMITIVE_MAX]; \
+  type sorted[PRIMITIVE_MAX]; \
+  for (round = 0; round < PRIMITIVE_ROUNDS; round++) { \
+    for (size = 0; size < PRIMITIVE_MAX; size++) { \
+      for (i = 0; i < size; i++) { \
+        r = lrand48(); \
+        keys[i] = (type)(value); \
+      } \
+      memcpy(sorted, keys, size * sizeof(type)); \
+      memcpy(quick, keys, size * sizeof(type)); \
+      memcpy(merge, keys, size * sizeof(type)); \
+      memcpy(tim, keys, size * sizeof(type)); \
+      name ## _binary_insertion_sort(sorted, size); \
+      name ## _bitonic_sort(keys, size); \
+      name ## _quick_sort(quick, size); \
+      name ## _merge_sort(merge, size); \
+      name ## _tim_sort(tim, size); \
+      for (i = 0; i < size; i++) { \
+        res = res && (keys[i] == sorted[i]) && (quick[i] == sorted[i]) && \
+              (merge[i] == sorted[i]) && (tim[i] == sorted[i]); \
+      } \
+      res = res && (name ## _is_sorted_until(sorted, size) == size); \
+      if (size > 1) { \
+        r = lrand48(); \
+        sorted[r % size] = (type)(value); \
+        i = 1; \
+        while ((i < size) && !(sorted[i] < sorted[i - 1])) { \
+          i++; \
+        } \
+        res = res && (name ## _is_sorted_until(sorted, size) == i); \
+      } \
+    } \
+  } \
+} while (0)
+
+/* bitonic_sort, quick_sort, merge_sort, tim_sort and is_sorted_until at every SIMD
+   level this CPU has, from the best one down */
+int primitive_tests(void) {
+  size_t size, i;
+  int round, res = 1;
+  const int best = sort_simd_level();
+  int level;
+  long r;
+
+  for (level = best; level >= SORT_SIMD_SCALAR; level--) {
+    sort_simd_use(level);
+    PRIMITIVE_TEST(prim_i32, int32_t, (i % 2) ? r % 5 - 2 : r - 1073741824L);
+    PRIMITIVE_TEST(prim_u32, uint32_t, (i % 2) ? r % 5 : (uint32_t)r * 3U);
+    PRIMITIVE_TEST(prim_u64, uint64_t, (i % 2) ? (uint64_t)(r % 5) : (uint64_t)r << (i % 40));
+    PRIMITIVE_TEST(prim_i64, int64_t, (i % 2) ? r % 5 - 2 : r % 2000001 - 1000000);
+    PRIMITIVE_TEST(prim_f32, float, (i % 3 == 0) ? -0.0f : (float)(r % 2001 - 1000) / 8);
+    PRIMITIVE_TEST(prim_f64, double, (i % 3 == 0) ? 0.0 : (i % 3 == 1) ? -0.0 : (double)(r - 1073741824L) / 3);
+  }
+
+  sort_simd_use(best);
+  printf("%21s -- %s\n", "primitive sorts", res ? "ok" : "FAILED");
+  return res;
+}
+
+/* every sorting network, on keys with lots of duplicates or none, checked against
+   binary insertion sort */
+#define NETWORK_ROUNDS 1000
+#define NETWORK_MAX 64
+
+int network_tests(void) {
+  int64_t keys[NETWORK_MAX], sorted[NETWORK_MAX];
+  size_t size, i;
+  int round, res = 1;
+
+  for (round = 0; round < NETWORK_ROUNDS; round++) {
+    for (size = 0; size <= NETWORK_MAX; size++) {
+      for (i = 0; i < size; i++) {
+        keys[i] = (round % 2) ? lrand48() % 5 : lrand48();
+      }
+
+      memcpy(sorted, keys, size * sizeof(int64_t));
+      networks_binary_insertion_sort(sorted, size);
+      networks_bitonic_sort(keys, size);
+      res = res && (memcmp(keys, sorted, size * sizeof(int64_t)) == 0);
+    }
+  }
+
+  printf("%21s -- %s\n", "sorting networks", res ? "ok" : "FAILED");
+  return res;
+}
+
+/* float and double radix sort against qsort in IEEE-754 total order, with infinities,
+   zeros and NaNs of both signs, the NaNs first for prim_f32 and last for prim_f64;
+   every size below 256, which radix sort leaves to an insertion sort, then bigger ones */
+#define FLOAT_RADIX_ROUNDS 20
+#define FLOAT_RADIX_MAX 5000
+
+static int nans_first;
+
+static int total_order(const double x, const double y) {
+  if ((x != x) || (y != y)) {
+    return nans_first ? (y != y) - (x != x) : (x != x) - (y != y);
+  }
+
+  if (x < y) {
+    return -1;
+  }
+
+  if (y < x) {
+    return 1;
+  }
+
+  /* 1 / -0.0 is -inf */
+  return ((x == 0) && (y == 0)) ? (1 / y < 0) - (1 / x < 0) : 0;
+}
+
+static int total_order_f32(const void *a, const void *b) {
+  return total_order(*(const float *)a, *(const float *)b);
+}
+
+static int total_order_f64(const void *a, const void *b) {
+  return total_order(*(const double *)a, *(const double *)b);
+}
+
+#define FLOAT_RADIX_TEST(name, type, cmp, first) do { \
+  type keys[FLOAT_RADIX_MAX], sorted[FLOAT_RADIX_MAX]; \
+  nans_first = first; \
+  for (round = 0; round < 256 + FLOAT_RADIX_ROUNDS; round++) { \
+    size = (round < 256) ? (size_t)round : (size_t)(256 + lrand48() % (FLOAT_RADIX_MAX - 256)); \
+    for (i = 0; i < size; i++) { \
+      r = lrand48(); \
+      keys[i] = (type)((r % 4 == 0) ? specials[r / 4 % 6] : (double)(r % 2001 - 1000) / 8); \
+    } \
+    memcpy(sorted, keys, size * sizeof(type)); \
+    qsort(sorted, size, sizeof(type), cmp); \
+    name ## _radix_sort(keys, size); \
+    for (i = 0; i < size; i++) { \
+      res = res && (cmp(&keys[i], &sorted[i]) == 0); \
+    } \
+  } \
+} while (0)
+
+int float_radix_tests(void) {
+  volatile double zero = 0.0;
+  double specials[6];
+  size_t size, i;
+  int round, res = 1;
+  long r;
+  specials[0] = zero / zero;
+  specials[1] = -specials[0];
+  specials[2] = 1 / zero;
+  specials[3] = -specials[2];
+  specials[4] = zero;
+  specials[5] = -specials[4];
+  FLOAT_RADIX_TEST(prim_f32, float, total_order_f32, 1);
+  FLOAT_RADIX_TEST(prim_f64, double, total_order_f64, 0);
+  printf("%21s -- %s\n", "float radix sort", res ? "ok" : "FAILED");
+  return res;
 }
 
 int main(void) {
   int i = 0;
   int64_t sizes[TESTS];
+#ifdef SET_SORT_PARALLEL
+  sort_ctx_options options;
+  test_executor executor;
+  memset(&options, 0, sizeof(options));
+  options.nthreads = TEST_THREADS;
+  test_ctx = sort_ctx_create(&options);
+  executor.count = 0;
+  options.executor = &executor;
+  options.submit = test_executor_submit;
+  options.wait = test_executor_wait;
+  executor_ctx = sort_ctx_create(&options);
+  memset(&options, 0, sizeof(options));
+  options.nthreads = TEST_THREADS;
+  options.numa_nodes = 2;
+  numa_ctx = sort_ctx_create(&options);
+#endif
   srand48(SEED);
   stable_tests();
+
+  if (!string_tests() || !network_tests() || !primitive_tests() || !float_radix_tests()) {
+    return 1;
+  }
+
   fill_random(sizes, TESTS);
 
   for (i = 0; i < TESTS; i++) {
@@ -409,5 +1212,10 @@ int main(void) {
     }
   }
 
+#ifdef SET_SORT_PARALLEL
+  sort_ctx_destroy(numa_ctx);
+  sort_ctx_destroy(executor_ctx);
+  sort_ctx_destroy(test_ctx);
+#endif
   return 0;
 }